@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "pre_analyzed_token_stream.hpp"
+
+#include "utils/attributes.hpp"
+#include "utils/bytes_utils.hpp"
+
+namespace {
+
+using namespace irs;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief reads a variable length integer not crossing 'end'
+/// @returns false if an input is truncated or malformed
+////////////////////////////////////////////////////////////////////////////////
+inline bool read_vint(
+    const byte_type*& in,
+    const byte_type* end,
+    uint32_t& value) noexcept {
+  value = 0;
+
+  for (uint32_t shift = 0; in != end && shift < 32; shift += 7) {
+    const uint32_t b = *in++;
+    value |= (b & 0x7F) << shift;
+
+    if (!(b & 0x80)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}
+
+namespace iresearch {
+namespace analysis {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                      pre_analyzed_token_stream::recorder
+// -----------------------------------------------------------------------------
+
+pre_analyzed_token_stream::recorder::recorder(analyzer::ptr&& impl)
+  : analyzer(irs::type<recorder>::get()),
+    impl_(std::move(impl)) {
+  assert(impl_);
+  term_ = irs::get<term_attribute>(*impl_);
+  inc_ = irs::get<increment>(*impl_);
+  offs_ = irs::get<offset>(*impl_);
+}
+
+bool pre_analyzed_token_stream::recorder::reset(const string_ref& data) {
+  data_.clear();
+  data_.push_back(FORMAT_VERSION);
+  start_ = 0;
+
+  return impl_->reset(data);
+}
+
+bool pre_analyzed_token_stream::recorder::next() {
+  if (!impl_->next()) {
+    return false;
+  }
+
+  // streams missing required attributes are rejected by the inverter
+  if (term_ && inc_) {
+    const uint32_t start = offs_ ? offs_->start : start_;
+    const uint32_t end = offs_ ? offs_->end : start;
+    const auto& term = term_->value;
+
+    auto out = std::back_inserter(data_);
+    irs::vwrite<uint32_t>(out, inc_->value);
+    irs::vwrite<uint32_t>(out, start - start_);
+    irs::vwrite<uint32_t>(out, end - start);
+    irs::vwrite<uint32_t>(out, static_cast<uint32_t>(term.size()));
+    data_.append(term.c_str(), term.size());
+
+    start_ = start;
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                          pre_analyzed_token_stream implementation
+// -----------------------------------------------------------------------------
+
+pre_analyzed_token_stream::pre_analyzed_token_stream() noexcept
+  : analyzer(irs::type<pre_analyzed_token_stream>::get()) {
+}
+
+bool pre_analyzed_token_stream::reset(const bytes_ref& data) noexcept {
+  std::get<offset>(attrs_).clear();
+  std::get<stream_error>(attrs_).value = false;
+
+  if (data.empty() || FORMAT_VERSION != data[0]) {
+    std::get<stream_error>(attrs_).value = true;
+    begin_ = end_ = nullptr;
+    return false;
+  }
+
+  begin_ = data.c_str() + 1;
+  end_ = data.c_str() + data.size();
+
+  return true;
+}
+
+bool pre_analyzed_token_stream::next() noexcept {
+  if (begin_ == end_) {
+    return false;
+  }
+
+  uint32_t inc, start_delta, length, size;
+
+  if (!read_vint(begin_, end_, inc)
+      || !read_vint(begin_, end_, start_delta)
+      || !read_vint(begin_, end_, length)
+      || !read_vint(begin_, end_, size)
+      || size > size_t(end_ - begin_)) {
+    std::get<stream_error>(attrs_).value = true; // malformed input
+    begin_ = end_;
+    return false;
+  }
+
+  auto& offs = std::get<offset>(attrs_);
+  offs.start += start_delta;
+  offs.end = offs.start + length;
+  std::get<increment>(attrs_).value = inc;
+  std::get<term_attribute>(attrs_).value = bytes_ref(begin_, size);
+  begin_ += size;
+
+  return true;
+}
+
+} // analysis
+} // ROOT
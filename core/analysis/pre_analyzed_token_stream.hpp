@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_PRE_ANALYZED_TOKEN_STREAM_H
+#define IRESEARCH_PRE_ANALYZED_TOKEN_STREAM_H
+
+#include "analysis/analyzer.hpp"
+#include "analysis/token_attributes.hpp"
+#include "utils/frozen_attributes.hpp"
+#include "utils/noncopyable.hpp"
+#include "utils/string.hpp"
+
+namespace iresearch {
+namespace analysis {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class pre_analyzed_token_stream
+/// @brief replays tokens of a value analyzed beforehand, e.g. by a producer
+///        of replicated data, terms are referenced directly from the input
+///
+/// pre-analyzed format:
+///   byte: FORMAT_VERSION
+///   for every token:
+///     vint: position increment
+///     vint: start offset delta to a start offset of the previous token
+///     vint: token length in bytes of the original value, i.e. end - start
+///     vint: term size
+///     term bytes
+/// @note offset deltas are computed modulo 2^32
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API pre_analyzed_token_stream final
+    : public analyzer,
+      private util::noncopyable {
+ public:
+  static constexpr byte_type FORMAT_VERSION = 0;
+
+  static constexpr string_ref type_name() noexcept {
+    return "pre_analyzed";
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @class recorder
+  /// @brief passes through tokens of a wrapped analyzer encoding them into
+  ///        the pre-analyzed format, i.e. a value is analyzed once while
+  ///        being indexed and its tokens may be stored along with it
+  //////////////////////////////////////////////////////////////////////////////
+  class IRESEARCH_API recorder final
+      : public analyzer,
+        private util::noncopyable {
+   public:
+    static constexpr string_ref type_name() noexcept {
+      return "pre_analyzed_recorder";
+    }
+
+    explicit recorder(analyzer::ptr&& impl);
+
+    virtual bool reset(const string_ref& data) override;
+
+    virtual bool next() override;
+
+    virtual attribute* get_mutable(type_info::type_id type) override {
+      return impl_->get_mutable(type);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @returns tokens emitted since the last 'reset(...)' in the
+    ///          pre-analyzed format
+    ////////////////////////////////////////////////////////////////////////////
+    const bstring& data() const noexcept { return data_; }
+
+   private:
+    analyzer::ptr impl_;
+    const term_attribute* term_;
+    const increment* inc_;
+    const offset* offs_;
+    bstring data_;
+    uint32_t start_{}; // start offset of the last recorded token
+  }; // recorder
+
+  pre_analyzed_token_stream() noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @param data value in the pre-analyzed format, must remain valid while
+  ///        its tokens are consumed
+  /// @returns false if the format version is not supported, 'stream_error'
+  ///          is set in that case
+  //////////////////////////////////////////////////////////////////////////////
+  bool reset(const bytes_ref& data) noexcept;
+
+  virtual bool reset(const string_ref& data) noexcept override {
+    return reset(ref_cast<byte_type>(data));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @note a truncated or malformed input terminates the stream and sets
+  ///       'stream_error', i.e. it's distinguishable from the end of input
+  //////////////////////////////////////////////////////////////////////////////
+  virtual bool next() noexcept override;
+
+  virtual attribute* get_mutable(type_info::type_id type) noexcept override {
+    return irs::get_mutable(attrs_, type);
+  }
+
+ private:
+  std::tuple<increment, offset, term_attribute, stream_error> attrs_;
+  const byte_type* begin_{};
+  const byte_type* end_{};
+}; // pre_analyzed_token_stream
+
+} // analysis
+} // ROOT
+
+#endif // IRESEARCH_PRE_ANALYZED_TOKEN_STREAM_H
@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "shingle_token_stream.hpp"
+
+#include <iterator>
+
+#include "utils/attributes.hpp"
+#include "utils/bytes_utils.hpp"
+
+namespace {
+
+// companion field name suffix, control character makes clashes with
+// user-defined field names unlikely
+const irs::string_ref SHINGLE_FIELD_SUFFIX = "\x1Fshingles";
+
+}
+
+namespace iresearch {
+
+REGISTER_ATTRIBUTE(phrase_shingles);
+
+std::string shingle_field(const string_ref& field) {
+  std::string name;
+  name.reserve(field.size() + SHINGLE_FIELD_SUFFIX.size());
+  name.append(field.c_str(), field.size());
+  name.append(SHINGLE_FIELD_SUFFIX.c_str(), SHINGLE_FIELD_SUFFIX.size());
+  return name;
+}
+
+bstring make_shingle(const bytes_ref& lhs, const bytes_ref& rhs) {
+  bstring shingle;
+  shingle.reserve(bytes_io<uint32_t>::const_max_vsize + lhs.size() + rhs.size());
+
+  auto out = std::back_inserter(shingle);
+  irs::vwrite<uint32_t>(out, static_cast<uint32_t>(lhs.size()));
+  shingle.append(lhs.c_str(), lhs.size());
+  shingle.append(rhs.c_str(), rhs.size());
+
+  return shingle;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                           shingle_token_stream::recorder
+// -----------------------------------------------------------------------------
+
+shingle_token_stream::recorder::recorder(
+    token_stream& impl,
+    shingle_token_stream& shingles) noexcept
+  : impl_(&impl),
+    shingles_(&shingles),
+    term_(irs::get<term_attribute>(impl)),
+    inc_(irs::get<increment>(impl)) {
+}
+
+bool shingle_token_stream::recorder::next() {
+  if (!impl_->next()) {
+    return false;
+  }
+
+  // streams missing required attributes are rejected by the inverter
+  if (term_ && inc_) {
+    shingles_->push_back(term_->value, inc_->value);
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                               shingle_token_stream implementation
+// -----------------------------------------------------------------------------
+
+void shingle_token_stream::reset() noexcept {
+  tokens_.clear();
+  data_.clear();
+  left_ = 0;
+  right_ = 0;
+  pos_ = 0;
+  last_pos_ = 0;
+}
+
+void shingle_token_stream::push_back(const bytes_ref& term, uint32_t inc) {
+  pos_ += inc;
+  tokens_.push_back({ data_.size(), term.size(), pos_ });
+  data_.append(term.c_str(), term.size());
+}
+
+bool shingle_token_stream::next() {
+  // tokens are ordered by position, pair every token with
+  // all tokens located at the next position
+  for (const size_t size = tokens_.size(); left_ < size; ++left_, right_ = 0) {
+    const auto& lhs = tokens_[left_];
+
+    if (!right_) {
+      // skip tokens sharing a position with 'lhs'
+      right_ = left_ + 1;
+      while (right_ < size && tokens_[right_].pos == lhs.pos) {
+        ++right_;
+      }
+    }
+
+    if (right_ < size && tokens_[right_].pos == lhs.pos + 1) {
+      const auto& rhs = tokens_[right_++];
+
+      value_ = make_shingle(term(lhs), term(rhs));
+      std::get<term_attribute>(attrs_).value = value_;
+      std::get<increment>(attrs_).value = lhs.pos - last_pos_;
+      last_pos_ = lhs.pos;
+
+      return true;
+    }
+  }
+
+  carry();
+  return false;
+}
+
+void shingle_token_stream::carry() {
+  // tokens at the last position may still pair with the first tokens of
+  // the next instance of a field, all the others are already shingled
+  auto it = tokens_.end();
+  while (it != tokens_.begin() && std::prev(it)->pos == pos_) {
+    --it;
+  }
+
+  if (it == tokens_.begin()) {
+    left_ = right_ = 0;
+    return;
+  }
+
+  const size_t shift = it == tokens_.end() ? data_.size() : it->begin;
+  tokens_.erase(tokens_.begin(), it);
+  data_.erase(0, shift);
+
+  for (auto& t : tokens_) {
+    t.begin -= shift;
+  }
+
+  left_ = right_ = 0;
+}
+
+} // ROOT
@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef IRESEARCH_SHINGLE_TOKEN_STREAM_H
+#define IRESEARCH_SHINGLE_TOKEN_STREAM_H
+
+#include <vector>
+
+#include "analysis/token_attributes.hpp"
+#include "analysis/token_stream.hpp"
+#include "utils/frozen_attributes.hpp"
+#include "utils/noncopyable.hpp"
+#include "utils/string.hpp"
+
+namespace iresearch {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct phrase_shingles
+/// @brief field feature requesting every pair of adjacent tokens of a field
+///        to be indexed as a single term of a hidden companion field named
+///        'shingle_field(field)', exact phrases over such a field are then
+///        evaluated by 'by_phrase' via the much shorter shingle postings
+/// @note positions of shingles follow positions of a field across all of
+///       its instances in a document, i.e. shingles spanning adjacent
+///       values are produced as well
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API phrase_shingles {
+  // DO NOT CHANGE NAME
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::phrase_shingles";
+  }
+}; // phrase_shingles
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns name of a companion field holding shingles of a specified field
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API std::string shingle_field(const string_ref& field);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns shingle term made of a specified pair of adjacent terms
+/// @note left term length is prepended so that distinct pairs never clash
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API bstring make_shingle(const bytes_ref& lhs, const bytes_ref& rhs);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class shingle_token_stream
+/// @brief produces shingles of tokens recorded via 'recorder', a shingle gets
+///        a position of its left token
+/// @note tokens recorded after the stream is exhausted continue positions
+///       of the previous ones, e.g. the next instance of a field in the same
+///       document, until 'reset()' is called
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API shingle_token_stream final
+    : public token_stream,
+      private util::noncopyable {
+ public:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @class recorder
+  /// @brief passes through tokens of a wrapped stream remembering their
+  ///        terms and positions
+  //////////////////////////////////////////////////////////////////////////////
+  class IRESEARCH_API recorder final
+      : public token_stream,
+        private util::noncopyable {
+   public:
+    recorder(token_stream& impl, shingle_token_stream& shingles) noexcept;
+
+    virtual bool next() override;
+
+    virtual attribute* get_mutable(type_info::type_id type) override {
+      return impl_->get_mutable(type);
+    }
+
+   private:
+    token_stream* impl_;
+    shingle_token_stream* shingles_;
+    const term_attribute* term_;
+    const increment* inc_;
+  }; // recorder
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief discard recorded tokens, positions start over
+  //////////////////////////////////////////////////////////////////////////////
+  void reset() noexcept;
+
+  virtual bool next() override;
+
+  virtual attribute* get_mutable(type_info::type_id type) noexcept override {
+    return irs::get_mutable(attrs_, type);
+  }
+
+ private:
+  struct token {
+    size_t begin; // offset in 'data_'
+    size_t size;
+    uint32_t pos;
+  };
+
+  void push_back(const bytes_ref& term, uint32_t inc);
+  void carry(); // keeps tokens which may still be shingled
+
+  bytes_ref term(const token& t) const noexcept {
+    return { data_.c_str() + t.begin, t.size };
+  }
+
+  std::tuple<increment, term_attribute> attrs_;
+  std::vector<token> tokens_;
+  bstring data_; // recorded terms
+  bstring value_; // current shingle
+  size_t left_{};
+  size_t right_{};
+  uint32_t pos_{}; // position of the last recorded token
+  uint32_t last_pos_{}; // position of the last emitted shingle
+}; // shingle_token_stream
+
+} // ROOT
+
+#endif // IRESEARCH_SHINGLE_TOKEN_STREAM_H
@@ -188,6 +188,15 @@ struct IRESEARCH_API postings_reader {
     IndexFeatures field_features,
     const term_provider_f& provider,
     size_t* set) = 0;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns the only document denoted by 'meta' if it's inlined into the
+  ///          term metadata, i.e. available without reading postings,
+  ///          'doc_limits::invalid()' otherwise
+  //////////////////////////////////////////////////////////////////////////////
+  virtual doc_id_t single_doc(const term_meta& /*meta*/) const noexcept {
+    return doc_limits::invalid();
+  }
 }; // postings_reader
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -259,6 +268,15 @@ struct IRESEARCH_API term_reader: public attribute_provider {
     const seek_cookie& cookie,
     IndexFeatures features) const = 0;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns the only document of a term denoted by 'meta' if it's
+  ///          available without reading postings, 'doc_limits::invalid()'
+  ///          otherwise
+  //////////////////////////////////////////////////////////////////////////////
+  virtual doc_id_t single_doc(const term_meta& /*meta*/) const {
+    return doc_limits::invalid();
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   /// @returns field metadata
   //////////////////////////////////////////////////////////////////////////////
@@ -62,6 +62,9 @@ extern "C" {
 #include "utils/type_limits.hpp"
 #include "utils/std.hpp"
 
+#include <cstring>
+#include <numeric>
+
 #if defined(_MSC_VER)
 #pragma warning(disable : 4351)
 #endif
@@ -1748,6 +1751,68 @@ class doc_iterator final : public irs::doc_iterator {
   #pragma GCC diagnostic pop
 #endif
 
+  virtual size_t next_batch(
+      doc_id_t* docs,
+      [[maybe_unused]] uint32_t* freqs,
+      size_t size) override {
+    auto& doc = std::get<document>(attrs_);
+    [[maybe_unused]] uint32_t notify{0};
+
+    size_t count = 0;
+    while (count < size) {
+      if (begin_ == end_) {
+        cur_pos_ += relative_pos();
+
+        if (cur_pos_ == term_state_.docs_count) {
+          doc.value = doc_limits::eof();
+          begin_ = end_ = docs_; // seal the iterator
+          break;
+        }
+
+        refill();
+      }
+
+      // copy as much of the decoded block as fits into the buffer
+      const size_t n = std::min(size - count, size_t(end_ - begin_));
+
+      doc_id_t value = doc.value;
+      for (auto* begin = docs + count, *end = begin + n; begin != end; ++begin) {
+        value += *begin_++;
+        *begin = value;
+      }
+      doc.value = value;
+
+      if constexpr (IteratorTraits::frequency()) {
+        if (freqs) {
+          std::memcpy(freqs + count, doc_freq_, n*sizeof(uint32_t));
+        }
+
+        if constexpr (IteratorTraits::position()) {
+          notify = std::accumulate(doc_freq_, doc_freq_ + n, notify);
+        }
+
+        doc_freq_ += n;
+        std::get<frequency>(attrs_).value = doc_freq_[-1];
+      }
+
+      count += n;
+    }
+
+    if constexpr (IteratorTraits::position()) {
+      if (count) {
+        auto& pos = std::get<position<IteratorTraits, FieldTraits>>(attrs_);
+        pos.notify(notify);
+        pos.clear();
+      }
+    }
+
+    return count;
+  }
+
+  virtual bool has_native_batch() const noexcept override {
+    return true;
+  }
+
  private:
   void seek_to_block(doc_id_t target);
 
@@ -2692,6 +2757,13 @@ class postings_reader_base : public irs::postings_reader {
     IndexFeatures field_features,
     irs::term_meta& state) final;
 
+  virtual doc_id_t single_doc(const irs::term_meta& meta) const noexcept final {
+    // singleton document is encoded into 'e_single_doc'
+    return 1 == meta.docs_count
+      ? doc_limits::min() + static_cast<const version10::term_meta&>(meta).e_single_doc
+      : doc_limits::invalid();
+  }
+
  protected:
   index_input::ptr doc_in_;
   index_input::ptr pos_in_;
@@ -82,6 +82,7 @@
 #include "store/memory_directory.hpp"
 #include "store/store_utils.hpp"
 #include "utils/automaton.hpp"
+#include "utils/bloom_filter.hpp"
 #include "utils/encryption.hpp"
 #include "utils/hash_utils.hpp"
 #include "utils/memory.hpp"
@@ -706,6 +707,16 @@ void write_field_features(
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @returns true if terms of a field are accompanied by a bloom filter
+////////////////////////////////////////////////////////////////////////////////
+inline bool has_bloom_filter(
+    burst_trie::Version version,
+    const irs::feature_map_t& features) {
+  return version >= burst_trie::Version::IMMUTABLE_FST &&
+         features.end() != features.find(irs::type<term_bloom_filter>::id());
+}
+
 IndexFeatures read_index_features(data_input& in) {
   const uint32_t index_features = in.read_int();
 
@@ -1045,6 +1056,7 @@ class field_writer final : public irs::field_writer {
   std::pair<bool, volatile_byte_ref> min_term_; // current min term in a block
   volatile_byte_ref max_term_; // current max term in a block
   uint64_t term_count_; // count of terms
+  std::vector<uint64_t> term_hashes_; // hashes of field terms for bloom filter
   size_t fields_count_{};
   const burst_trie::Version version_;
   const uint32_t min_block_size_;
@@ -1375,6 +1387,9 @@ void field_writer::write(
   auto* docs = irs::get<version10::documents>(*pw_);
   assert(docs);
 
+  term_hashes_.clear();
+  const bool bloom_exists = has_bloom_filter(version_, features);
+
   for (; terms.next();) {
     auto postings = terms.postings(index_features);
     auto meta = pw_->write(*postings);
@@ -1399,6 +1414,10 @@ void field_writer::write(
 
       max_term_.assign(term, consolidation_);
 
+      if (bloom_exists) {
+        term_hashes_.emplace_back(bloom_filter::hash(term));
+      }
+
       // increase processed term count
       ++term_count_;
     }
@@ -1461,6 +1480,17 @@ void field_writer::end_field(
     index_out_->write_vlong(total_term_freq);
   }
 
+  if (has_bloom_filter(version_, features)) {
+    assert(term_hashes_.size() == term_count_);
+    bloom_filter bloom(term_hashes_.size());
+
+    for (const auto hash : term_hashes_) {
+      bloom.insert(hash);
+    }
+
+    bloom.write(*index_out_);
+  }
+
   // build fst
   const entry& root = *stack_.begin();
   assert(fst_buf_);
@@ -1542,7 +1572,12 @@ class term_reader_base : public irs::term_reader,
 
   virtual void prepare(burst_trie::Version version, index_input& in, const feature_map_t& features);
 
+  const bloom_filter* bloom() const noexcept {
+    return bloom_.empty() ? nullptr : &bloom_;
+  }
+
  private:
+  bloom_filter bloom_;
   bstring min_term_;
   bstring max_term_;
   bytes_ref min_term_ref_;
@@ -1580,6 +1615,10 @@ void term_reader_base::prepare(
     freq_.value = in.read_vlong();
     pfreq_ = &freq_;
   }
+
+  if (has_bloom_filter(version, field_.features)) {
+    bloom_.read(in);
+  }
 }
 
 attribute* term_reader_base::get_mutable(irs::type_info::type_id type) noexcept {
@@ -2288,11 +2327,11 @@ class term_iterator final : public term_iterator_base {
       postings_reader& postings,
       const index_input& terms_in,
       irs::encryption::stream* terms_cipher,
-      const FST& fst)
+      std::shared_ptr<const FST> fst)
     : term_iterator_base(field, postings, terms_cipher, nullptr),
       terms_in_source_(&terms_in),
-      fst_(&fst),
-      matcher_(&fst, fst::MATCH_INPUT) { // pass pointer to avoid copying FST
+      fst_(std::move(fst)),
+      matcher_(fst_.get(), fst::MATCH_INPUT) { // pass pointer to avoid copying FST
   }
 
   virtual bool next() override;
@@ -2408,7 +2447,7 @@ class term_iterator final : public term_iterator_base {
 
   const index_input* terms_in_source_;
   mutable index_input::ptr terms_in_;
-  const FST* fst_;
+  std::shared_ptr<const FST> fst_; // keeps lazily loaded FST alive
   explicit_matcher<FST> matcher_;
   seek_state_t sstate_;
   std::vector<block_iterator> block_stack_;
@@ -2707,12 +2746,14 @@ class single_term_iterator final : public seek_term_iterator {
       postings_reader& postings,
       index_input::ptr&& terms_in,
       irs::encryption::stream* terms_cipher,
-      const FST& fst) noexcept
+      std::shared_ptr<const FST> fst,
+      const bloom_filter* bloom) noexcept
     : terms_in_{std::move(terms_in)},
       cipher_{terms_cipher},
       postings_{&postings},
       field_{&field},
-      fst_{&fst} {
+      fst_{std::move(fst)},
+      bloom_{bloom} {
     assert(terms_in_);
   }
 
@@ -2769,7 +2810,8 @@ class single_term_iterator final : public seek_term_iterator {
   irs::encryption::stream* cipher_;
   postings_reader* postings_;
   const field_meta* field_;
-  const FST* fst_;
+  std::shared_ptr<const FST> fst_; // keeps lazily loaded FST alive
+  const bloom_filter* bloom_;
 }; // single_term_iterator
 
 // -----------------------------------------------------------------------------
@@ -2778,11 +2820,17 @@ class single_term_iterator final : public seek_term_iterator {
 
 template<typename FST>
 bool single_term_iterator<FST>::seek(const bytes_ref& term) {
+  if (bloom_ && !bloom_->may_contain(term)) {
+    // definitely absent
+    value_ = bytes_ref::NIL;
+    return false;
+  }
+
   assert(fst_->GetImpl());
   auto& fst = *fst_->GetImpl();
 
   auto state = fst.Start();
-  explicit_matcher<FST> matcher{fst_, fst::MATCH_INPUT};
+  explicit_matcher<FST> matcher{fst_.get(), fst::MATCH_INPUT};
 
   byte_weight weight_prefix;
   const auto* weight_suffix = &fst.FinalRef(state);
@@ -2914,14 +2962,14 @@ class automaton_term_iterator final : public term_iterator_base {
                                    postings_reader& postings,
                                    index_input::ptr&& terms_in,
                                    irs::encryption::stream* terms_cipher,
-                                   const FST& fst,
+                                   std::shared_ptr<const FST> fst,
                                    automaton_table_matcher& matcher)
     : term_iterator_base(field, postings, terms_cipher, &payload_),
       terms_in_(std::move(terms_in)),
-      fst_(&fst),
+      fst_(std::move(fst)),
       acceptor_(&matcher.GetFst()),
       matcher_(&matcher),
-      fst_matcher_(&fst, fst::MATCH_INPUT),
+      fst_matcher_(fst_.get(), fst::MATCH_INPUT),
       sink_(matcher.sink()) {
     assert(terms_in_);
     assert(fst::kNoStateId != acceptor_->Start());
@@ -3026,7 +3074,7 @@ class automaton_term_iterator final : public term_iterator_base {
   }
 
   index_input::ptr terms_in_;
-  const FST* fst_;
+  std::shared_ptr<const FST> fst_; // keeps lazily loaded FST alive
   const automaton* acceptor_;
   automaton_table_matcher* matcher_;
   explicit_matcher<FST> fst_matcher_;
@@ -3285,6 +3333,34 @@ class field_reader final : public irs::field_reader {
   }
 
  private:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @class lazy_fst
+  /// @brief term index of a field loaded on first access, may be evicted
+  ///        by 'term_index_cache'
+  //////////////////////////////////////////////////////////////////////////////
+  class lazy_fst final : public burst_trie::term_index_cache::entry {
+   public:
+    lazy_fst(field_reader& owner, uint64_t offset) noexcept
+      : owner_(&owner),
+        offset_(offset) {
+    }
+
+    virtual ~lazy_fst() {
+      owner_->terms_index_cache_->remove(*this);
+    }
+
+    std::shared_ptr<const immutable_byte_fst> get(const field_meta& field);
+
+    virtual void evict() noexcept override {
+      std::atomic_store(&fst_, std::shared_ptr<const immutable_byte_fst>());
+    }
+
+   private:
+    std::shared_ptr<const immutable_byte_fst> fst_;
+    field_reader* owner_;
+    uint64_t offset_;
+  }; // lazy_fst
+
   template<typename FST>
   class term_reader final : public term_reader_base {
    public:
@@ -3301,9 +3377,27 @@ class field_reader final : public irs::field_reader {
       term_reader_base::prepare(version, in, features);
 
       // read FST
-      input_buf isb(&in);
-      std::istream input(&isb); // wrap stream to be OpenFST compliant
-      fst_.reset(FST::Read(input, fst_read_options()));
+      if constexpr (std::is_same_v<FST, immutable_byte_fst>) {
+        if (owner_->terms_index_cache_) {
+          // record offset only, FST is loaded on first access
+          lazy_ = memory::make_unique<lazy_fst>(*owner_, in.file_pointer());
+
+          if (!FST::Skip(in)) {
+            throw irs::index_error(string_utils::to_string(
+              "failed to read term index for field '%s'",
+              meta().name.c_str()));
+          }
+
+          return;
+        }
+
+        // reference FST weights in a mapped term index if possible
+        fst_.reset(FST::Read(in, owner_->terms_index_mapped_));
+      } else {
+        input_buf isb(&in);
+        std::istream input(&isb); // wrap stream to be OpenFST compliant
+        fst_.reset(FST::Read(input, fst_read_options()));
+      }
 
       if (!fst_) {
         throw irs::index_error(string_utils::to_string(
@@ -3325,12 +3419,12 @@ class field_reader final : public irs::field_reader {
 
         return memory::make_managed<single_term_iterator<FST>>(
           meta(), *owner_->pr_, std::move(terms_in),
-          owner_->terms_in_cipher_.get(), *fst_);
+          owner_->terms_in_cipher_.get(), fst(), bloom());
       }
 
       return memory::make_managed<term_iterator<FST>>(
         meta(), *owner_->pr_, *owner_->terms_in_,
-        owner_->terms_in_cipher_.get(), *fst_);
+        owner_->terms_in_cipher_.get(), fst());
     }
 
     virtual size_t bit_union(
@@ -3382,7 +3476,7 @@ class field_reader final : public irs::field_reader {
 
       return memory::make_managed<automaton_term_iterator<FST>>(
         meta(), *owner_->pr_, std::move(terms_in),
-        owner_->terms_in_cipher_.get(), *fst_, matcher);
+        owner_->terms_in_cipher_.get(), fst(), matcher);
     }
 
     virtual doc_iterator::ptr postings(
@@ -3398,9 +3492,24 @@ class field_reader final : public irs::field_reader {
         meta().index_features, features, impl->meta);
     }
 
+    virtual doc_id_t single_doc(const irs::term_meta& meta) const override {
+      return owner_->pr_->single_doc(meta);
+    }
+
    private:
+    std::shared_ptr<const FST> fst() const {
+      if constexpr (std::is_same_v<FST, immutable_byte_fst>) {
+        if (lazy_) {
+          return lazy_->get(meta());
+        }
+      }
+
+      return fst_;
+    }
+
     field_reader* owner_;
-    std::unique_ptr<FST> fst_;
+    std::shared_ptr<const FST> fst_;
+    std::unique_ptr<lazy_fst> lazy_;
   }; // term_reader
 
   using vector_fst_reader = term_reader<vector_byte_fst>;
@@ -3409,13 +3518,56 @@ class field_reader final : public irs::field_reader {
   using vector_fst_readers = std::vector<term_reader<vector_byte_fst>>;
   using immutable_fst_readers = std::vector<term_reader<immutable_byte_fst>>;
 
+  std::shared_ptr<burst_trie::term_index_cache> terms_index_cache_; // must outlive 'fields_'
+  std::mutex terms_index_mutex_; // serializes loading of lazy FSTs
   std::variant<immutable_fst_readers, vector_fst_readers> fields_;
   absl::flat_hash_map<hashed_string_ref, irs::term_reader*> name_to_field_;
   irs::postings_reader::ptr pr_;
   encryption::stream::ptr terms_in_cipher_;
   index_input::ptr terms_in_;
+  index_input::ptr terms_index_in_; // term index read by FSTs after opening
+  bool terms_index_mapped_{}; // FSTs reference 'terms_index_in_' in place
 }; // field_reader
 
+std::shared_ptr<const immutable_byte_fst> field_reader::lazy_fst::get(
+    const field_meta& field) {
+  auto& cache = *owner_->terms_index_cache_;
+  auto fst = std::atomic_load(&fst_);
+
+  if (fst) {
+    cache.touch(*this);
+    return fst;
+  }
+
+  std::lock_guard<std::mutex> lock(owner_->terms_index_mutex_);
+  fst = std::atomic_load(&fst_); // might have been loaded concurrently
+
+  if (!fst) {
+    auto in = owner_->terms_index_in_->reopen(); // reopen thread-safe stream
+
+    if (!in) {
+      // implementation returned wrong pointer
+      IR_FRMT_ERROR("Failed to reopen term index input in: %s", __FUNCTION__);
+
+      throw io_error("failed to reopen term index input");
+    }
+
+    in->seek(offset_);
+    fst.reset(immutable_byte_fst::Read(*in, owner_->terms_index_mapped_));
+
+    if (!fst) {
+      throw irs::index_error(string_utils::to_string(
+        "failed to read term index for field '%s'",
+        field.name.c_str()));
+    }
+
+    std::atomic_store(&fst_, fst);
+    cache.insert(*this, fst->MemoryUsage());
+  }
+
+  return fst;
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                        term_reader implementation
 // -----------------------------------------------------------------------------
@@ -3503,6 +3655,34 @@ void field_reader::prepare(
   // read terms for each indexed field
   if (term_index_version <= burst_trie::Version::ENCRYPTION_MIN) {
     fields_ = vector_fst_readers{};
+  } else if (!index_in_cipher) {
+    // if the whole term index is accessible via a persistent buffer
+    // (e.g. mmap), FSTs reference it in place instead of copying it
+    // to the heap, pages are then shared through the page cache
+    const uint64_t ptr = index_in->file_pointer();
+
+    terms_index_mapped_ = nullptr != index_in->read_buffer(
+      ptr, index_in->length() - ptr, BufferHint::PERSISTENT);
+
+    // FSTs are loaded on first access if requested
+    terms_index_cache_ = dir.attributes().get<burst_trie::term_index_cache>();
+
+    if (terms_index_mapped_ || terms_index_cache_) {
+      terms_index_in_ = dir.open(filename, IOAdvice::RANDOM);
+
+      if (!terms_index_in_) {
+        IR_FRMT_ERROR("Failed to open file, path: %s", filename.c_str());
+
+        throw io_error(string_utils::to_string(
+          "failed to open file, path: %s",
+          filename.c_str()));
+      }
+
+      // read via a separate stream sharing the same mapping
+      index_in = terms_index_in_->dup();
+    }
+
+    index_in->seek(ptr);
   }
 
   std::visit([&](auto& fields) {
@@ -3743,6 +3923,58 @@ class dumper : util::noncopyable {
 namespace iresearch {
 namespace burst_trie {
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                   term_index_cache implementation
+// -----------------------------------------------------------------------------
+
+/*static*/ term_index_cache::ptr term_index_cache::make(size_t memory_limit) {
+  return memory::make_unique<term_index_cache>(memory_limit);
+}
+
+void term_index_cache::insert(entry& e, size_t size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  assert(!e.linked_);
+  e.pos_ = entries_.insert(entries_.begin(), &e);
+  e.size_ = size;
+  e.linked_ = true;
+  e.accessed_.store(true, std::memory_order_relaxed);
+  memory_used_ += size;
+
+  // second chance eviction: recently accessed entries are moved to
+  // the front once, every entry is visited at most twice
+  for (size_t steps = 2*entries_.size();
+       steps && memory_used_ > memory_limit_ && entries_.size() > 1;
+       --steps) {
+    auto* victim = entries_.back();
+
+    if (victim == &e ||
+        victim->accessed_.exchange(false, std::memory_order_relaxed)) {
+      entries_.splice(entries_.begin(), entries_, victim->pos_);
+      continue;
+    }
+
+    entries_.pop_back();
+    victim->linked_ = false;
+    memory_used_ -= victim->size_;
+    victim->evict();
+  }
+}
+
+void term_index_cache::remove(entry& e) noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (e.linked_) {
+    entries_.erase(e.pos_);
+    e.linked_ = false;
+    memory_used_ -= e.size_;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                         factories
+// -----------------------------------------------------------------------------
+
 irs::field_writer::ptr make_writer(
     Version version,
     irs::postings_writer::ptr&& writer,
@@ -23,7 +23,13 @@
 #ifndef IRESEARCH_FORMAT_BURST_TRIE_H
 #define IRESEARCH_FORMAT_BURST_TRIE_H
 
+#include <atomic>
+#include <list>
+#include <mutex>
+
 #include "formats.hpp"
+#include "utils/attribute_store.hpp"
+#include "utils/noncopyable.hpp"
 
 namespace iresearch {
 namespace burst_trie {
@@ -54,6 +60,81 @@ enum class Version : int32_t {
   MAX = IMMUTABLE_FST
 }; // Version
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class term_index_cache
+/// @brief directory attribute enabling lazy loading of the term index, i.e.
+///        only offsets of per-field term indexes are recorded while opening
+///        a segment and term index of a field is loaded on first access
+///
+///        Loaded term indexes of all segments opened from a directory share
+///        the specified memory budget. Once exceeded, the least recently
+///        used ones are evicted while live iterators keep using them.
+/// @note applicable to non-encrypted term indexes stored as immutable FSTs
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API term_index_cache final : public stored_attribute {
+ public:
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::burst_trie::term_index_cache";
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @class entry
+  /// @brief evictable term index of a field
+  //////////////////////////////////////////////////////////////////////////////
+  class entry : private util::noncopyable {
+   public:
+    virtual ~entry() = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief release loaded term index, called under cache lock
+    ////////////////////////////////////////////////////////////////////////////
+    virtual void evict() noexcept = 0;
+
+   private:
+    friend class term_index_cache;
+
+    std::list<entry*>::iterator pos_;
+    size_t size_{};
+    bool linked_{};
+    std::atomic<bool> accessed_{};
+  }; // entry
+
+  DECLARE_FACTORY(size_t memory_limit);
+
+  explicit term_index_cache(size_t memory_limit) noexcept
+    : memory_limit_(memory_limit) {
+  }
+
+  size_t memory_limit() const noexcept { return memory_limit_; }
+  size_t memory_used() const noexcept { return memory_used_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief account a loaded term index of the specified size, evicts
+  ///        other entries until the memory budget is met
+  //////////////////////////////////////////////////////////////////////////////
+  void insert(entry& e, size_t size);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief mark entry as recently used
+  //////////////////////////////////////////////////////////////////////////////
+  void touch(entry& e) noexcept {
+    e.accessed_.store(true, std::memory_order_relaxed);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief stop accounting the specified entry if any
+  //////////////////////////////////////////////////////////////////////////////
+  void remove(entry& e) noexcept;
+
+ private:
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  std::mutex mutex_;
+  std::list<entry*> entries_; // most recently loaded first
+  std::atomic<size_t> memory_used_{0};
+  size_t memory_limit_;
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // term_index_cache
+
 IRESEARCH_API irs::field_writer::ptr make_writer(
   Version version,
   irs::postings_writer::ptr&& writer,
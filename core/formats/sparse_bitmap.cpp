@@ -435,6 +435,25 @@ void sparse_bitmap_iterator::seek_to_block(doc_id_t target) {
   } while (block_ < target);
 }
 
+size_t sparse_bitmap_iterator::next_batch(
+    doc_id_t* docs,
+    uint32_t* /*freqs*/,
+    size_t size) {
+  size_t count = 0;
+
+  for (; count < size; ++count) {
+    const doc_id_t doc = sparse_bitmap_iterator::seek(value() + 1);
+
+    if (doc_limits::eof(doc)) {
+      break;
+    }
+
+    docs[count] = doc;
+  }
+
+  return count;
+}
+
 doc_id_t sparse_bitmap_iterator::seek(doc_id_t target) {
   // FIXME
   if (target <= value()) {
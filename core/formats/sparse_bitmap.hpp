@@ -211,6 +211,9 @@ class sparse_bitmap_iterator final : public resettable_doc_iterator {
     return std::get<document>(attrs_).value;
   }
 
+  virtual size_t next_batch(doc_id_t* docs, uint32_t* freqs, size_t size) override final;
+  virtual bool has_native_batch() const noexcept override final { return true; }
+
   virtual void reset() override final;
 
   //////////////////////////////////////////////////////////////////////////////
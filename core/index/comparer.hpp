@@ -36,10 +36,59 @@ class comparer {
     return less(lhs, rhs);
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if a comparer is able to produce normalized keys,
+  ///          i.e. 'normalize(...)' is implemented
+  /// @note normalized keys allow to sort documents via radix sort and to merge
+  ///       sorted segments without calling 'less(...)' for every comparison
+  //////////////////////////////////////////////////////////////////////////////
+  virtual bool has_normalizer() const noexcept {
+    return false;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief append a normalized key of a specified value to 'out', such that
+  ///        byte-wise order of normalized keys (shorter keys go first in case
+  ///        of a common prefix) is the same as the order defined by 'less'
+  /// @note 'value' is nil for documents without a sort value
+  //////////////////////////////////////////////////////////////////////////////
+  virtual void normalize(const bytes_ref& /*value*/, bstring& /*out*/) const {
+    assert(false);
+  }
+
  protected:
   virtual bool less(const bytes_ref& lhs, const bytes_ref& rhs) const = 0;
 }; // comparer
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class memcmp_comparer
+/// @brief orders values byte-wise, documents without a value go first
+////////////////////////////////////////////////////////////////////////////////
+class memcmp_comparer final : public comparer {
+ public:
+  virtual bool has_normalizer() const noexcept override {
+    return true;
+  }
+
+  virtual void normalize(const bytes_ref& value, bstring& out) const override {
+    // nil values are represented by an empty key, others are
+    // prefixed by a marker to distinguish them from nil
+    if (!value.null()) {
+      out += byte_type(1);
+      out.append(value.c_str(), value.size());
+    }
+  }
+
+ protected:
+  virtual bool less(const bytes_ref& lhs, const bytes_ref& rhs) const override {
+    if (rhs.null()) {
+      return false;
+    }
+
+    return lhs.null() || lhs < rhs;
+  }
+}; // memcmp_comparer
+
 inline bool use_dense_sort(size_t size, size_t total) noexcept {
   // check: N*logN > K
   return std::isgreaterequal(
@@ -1034,6 +1034,7 @@ bool field_data::invert(token_stream& stream, doc_id_t id) {
 
   const auto* term = get<term_attribute>(stream);
   const auto* inc = get<increment>(stream);
+  const auto* err = get<stream_error>(stream);
   const offset* offs = nullptr;
   const payload* pay = nullptr;
 
@@ -1115,6 +1116,12 @@ bool field_data::invert(token_stream& stream, doc_id_t id) {
     last_pos_ = pos_;
   }
 
+  if (err && err->value) {
+    IR_FRMT_ERROR("invalid token stream input in field '%s'",
+                  meta_.name.c_str());
+    return false;
+  }
+
   if (offs) {
     offs_ += offs->end;
   }
@@ -85,4 +85,92 @@ const columnstore_reader::column_reader* sub_reader::column_reader(
   return meta ? column_reader(meta->id) : nullptr;
 }
 
+bool sub_reader::live(doc_id_t doc) const {
+  if (!doc_limits::valid(doc)) {
+    return false;
+  }
+
+  // iterator over live documents
+  auto it = docs_iterator();
+
+  return doc == it->seek(doc);
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 primary key lookup
+// -----------------------------------------------------------------------------
+
+size_t lookup_primary_keys(
+    const index_reader& reader,
+    const string_ref& field,
+    range<const bytes_ref> keys,
+    range<primary_key_hit> hits) {
+  assert(keys.size() <= hits.size());
+  assert(std::is_sorted(keys.begin(), keys.end()));
+
+  std::fill(hits.begin(), hits.end(), primary_key_hit{});
+
+  size_t found = 0;
+
+  // most recent segments are the last ones
+  for (size_t i = reader.size(); i && found < keys.size(); ) {
+    auto& segment = reader[--i];
+    const auto* terms = segment.field(field);
+
+    if (!terms) {
+      continue;
+    }
+
+    seek_term_iterator::ptr it; // reused for all keys within a segment
+
+    for (size_t k = 0, count = keys.size(); k < count; ++k) {
+      auto& hit = hits[k];
+      const auto& key = keys[k];
+
+      if (hit.segment) {
+        // already resolved in a more recent segment
+        continue;
+      }
+
+      if (key < (terms->min)() || (terms->max)() < key) {
+        continue;
+      }
+
+      if (!it) {
+        it = terms->iterator(SeekMode::RANDOM_ONLY);
+      }
+
+      if (!it->seek(key)) {
+        continue;
+      }
+
+      it->read();
+
+      const auto* meta = irs::get<term_meta>(*it);
+      doc_id_t doc = meta ? terms->single_doc(*meta) : doc_limits::invalid();
+
+      if (doc_limits::valid(doc)) {
+        if (!segment.live(doc)) {
+          continue;
+        }
+      } else {
+        // not a singleton term or the format doesn't inline it
+        auto docs = segment.mask(it->postings(IndexFeatures::NONE));
+
+        if (!docs->next()) {
+          continue;
+        }
+
+        doc = docs->value();
+      }
+
+      hit.segment = &segment;
+      hit.doc = doc;
+      ++found;
+    }
+  }
+
+  return found;
+}
+
 }
@@ -33,6 +33,7 @@
 #include "store/directory_attributes.hpp"
 #include "utils/iterator.hpp"
 #include "utils/memory.hpp"
+#include "utils/range.hpp"
 #include "utils/string.hpp"
 
 namespace iresearch {
@@ -138,6 +139,9 @@ struct IRESEARCH_API sub_reader : index_reader {
     return std::move(it);
   }
 
+  // returns true if a specified document exists and isn't deleted
+  virtual bool live(doc_id_t doc) const;
+
   // returns corresponding term_reader by the specified field
   virtual const term_reader* field(const string_ref& field) const = 0;
 
@@ -152,6 +156,33 @@ struct IRESEARCH_API sub_reader : index_reader {
   const columnstore_reader::column_reader* column_reader(const string_ref& field) const;
 }; // sub_reader
 
+////////////////////////////////////////////////////////////////////////////////
+/// @struct primary_key_hit
+/// @brief location of a live document denoted by a primary key
+////////////////////////////////////////////////////////////////////////////////
+struct primary_key_hit {
+  const sub_reader* segment{}; // nullptr if a key isn't found
+  doc_id_t doc{doc_limits::invalid()};
+}; // primary_key_hit
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief resolves a batch of keys of a unique 'field' to live documents,
+///        segments are probed from the most recent to the oldest one and
+///        a key is resolved by the first live document found, i.e. keys
+///        already resolved aren't looked up in older segments
+/// @param keys sorted keys to resolve
+/// @param hits receives a location of every key, must be at least as large
+///        as 'keys'
+/// @returns number of resolved keys
+/// @note postings aren't read for terms having a single document inlined
+///       into term metadata, e.g. formats derived from "1_0"
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API size_t lookup_primary_keys(
+  const index_reader& reader,
+  const string_ref& field,
+  range<const bytes_ref> keys,
+  range<primary_key_hit> hits);
+
 template<typename Visitor, typename FilterVisitor>
 void visit(const index_reader& index, const string_ref& field,
            const FilterVisitor& field_visitor, Visitor& visitor) {
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "index_snapshot.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "error/error.hpp"
+#include "utils/directory_utils.hpp"
+
+namespace iresearch {
+
+/*static*/ index_snapshot index_snapshot::open(
+    directory& dir,
+    const format::ptr& codec) {
+  auto reader = codec ? codec->get_index_meta_reader() : nullptr;
+
+  if (!reader) {
+    throw index_not_found();
+  }
+
+  index_snapshot snapshot;
+  index_file_refs::ref_t ref;
+
+  // ensure have a valid ref to a filename
+  while (!ref) {
+    if (!reader->last_segments_file(dir, snapshot.filename_)) {
+      throw index_not_found();
+    }
+
+    ref = directory_utils::reference(dir, snapshot.filename_);
+  }
+
+  reader->read(dir, snapshot.meta_, *ref);
+  snapshot.refs_.emplace_back(std::move(ref));
+
+  directory_utils::reference(
+    dir, snapshot.meta_,
+    [&snapshot](index_file_refs::ref_t&& ref) {
+      snapshot.files_.emplace_back(*ref);
+      snapshot.refs_.emplace_back(std::move(ref));
+      return true;
+    },
+    true);
+
+  snapshot.files_.emplace_back(snapshot.filename_);
+  std::sort(snapshot.files_.begin(), snapshot.files_.end());
+  snapshot.files_.erase(
+    std::unique(snapshot.files_.begin(), snapshot.files_.end()),
+    snapshot.files_.end());
+  snapshot.dir_ = &dir;
+
+  return snapshot;
+}
+
+std::vector<std::string> index_snapshot::changed(
+    const std::vector<std::string>& previous) const {
+  assert(std::is_sorted(previous.begin(), previous.end()));
+
+  std::vector<std::string> result;
+  std::set_difference(
+    files_.begin(), files_.end(),
+    previous.begin(), previous.end(),
+    std::back_inserter(result));
+
+  return result;
+}
+
+bool index_snapshot::copy(
+    directory& dst,
+    const std::vector<std::string>& files) const {
+  if (!dir_) {
+    return files.empty();
+  }
+
+  auto copy_file = [this, &dst](const std::string& file) {
+    // only pinned files are guaranteed to remain intact while being copied
+    if (!std::binary_search(files_.begin(), files_.end(), file)) {
+      return false;
+    }
+
+    return directory_utils::copy(*dir_, file, dst, file);
+  };
+
+  // copy data files first, allow 'dst' to sync them all at once
+  std::vector<std::reference_wrapper<const std::string>> copied;
+  copied.reserve(files.size());
+  bool copy_meta = false;
+
+  for (auto& file : files) {
+    if (file == filename_) {
+      copy_meta = true;
+    } else if (!copy_file(file)) {
+      return false;
+    } else {
+      copied.emplace_back(file);
+    }
+  }
+
+  if (!dst.sync_files({ copied.data(), copied.size() })) {
+    return false;
+  }
+
+  // index_meta file goes last once all data files are durable
+  return !copy_meta || (copy_file(filename_) && dst.sync(filename_));
+}
+
+} // ROOT
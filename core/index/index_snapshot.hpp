@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_INDEX_SNAPSHOT_H
+#define IRESEARCH_INDEX_SNAPSHOT_H
+
+#include <string>
+#include <vector>
+
+#include "formats/formats.hpp"
+#include "index/index_meta.hpp"
+#include "store/directory_attributes.hpp"
+#include "utils/noncopyable.hpp"
+
+namespace iresearch {
+
+struct directory;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class index_snapshot
+/// @brief a state of an index committed to a directory, files of the state
+///        are pinned, i.e. protected from 'directory_cleaner', while
+///        a snapshot is alive, so they may be copied, e.g. for a backup,
+///        without stopping writers
+/// @note index files are written once, i.e. files having the same name in
+///       different snapshots of the same directory have the same contents
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API index_snapshot : private util::noncopyable {
+ public:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief pin files of the latest index_meta committed to a directory
+  /// @throws index_not_found if there is no index committed via 'codec'
+  //////////////////////////////////////////////////////////////////////////////
+  static index_snapshot open(directory& dir, const format::ptr& codec);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief an empty snapshot, e.g. a baseline for the first full backup
+  //////////////////////////////////////////////////////////////////////////////
+  index_snapshot() = default;
+  index_snapshot(index_snapshot&&) = default;
+  index_snapshot& operator=(index_snapshot&&) = default;
+
+  explicit operator bool() const noexcept { return nullptr != dir_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return name of the index_meta file of a snapshot
+  //////////////////////////////////////////////////////////////////////////////
+  const std::string& filename() const noexcept { return filename_; }
+
+  const index_meta& meta() const noexcept { return meta_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return sorted names of all files of a snapshot including index_meta file
+  //////////////////////////////////////////////////////////////////////////////
+  const std::vector<std::string>& files() const noexcept { return files_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @param previous sorted names of files of a previous snapshot as returned
+  ///        by 'files()', e.g. persisted along with a previous backup
+  /// @return sorted names of files of a snapshot missing in 'previous'
+  //////////////////////////////////////////////////////////////////////////////
+  std::vector<std::string> changed(
+    const std::vector<std::string>& previous) const;
+
+  std::vector<std::string> changed(const index_snapshot& previous) const {
+    return changed(previous.files());
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief copy specified files of a snapshot into a directory 'dst' as is,
+  ///        index_meta file, if specified, is copied last once all the other
+  ///        files are synced so that partially copied files never form
+  ///        a committed index
+  /// @return success
+  //////////////////////////////////////////////////////////////////////////////
+  bool copy(directory& dst, const std::vector<std::string>& files) const;
+
+ private:
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  directory* dir_{};
+  std::string filename_;
+  index_meta meta_;
+  std::vector<std::string> files_;
+  std::vector<index_file_refs::ref_t> refs_;
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // index_snapshot
+
+} // ROOT
+
+#endif // IRESEARCH_INDEX_SNAPSHOT_H
@@ -30,12 +30,15 @@
 #include "shared.hpp"
 #include "formats/format_utils.hpp"
 #include "index/comparer.hpp"
+#include "index/composite_reader_impl.hpp"
+#include "index/directory_reader.hpp"
 #include "index/file_names.hpp"
 #include "index/merge_writer.hpp"
 #include "search/exclusion.hpp"
 #include "utils/bitvector.hpp"
 #include "utils/compression.hpp"
 #include "utils/directory_utils.hpp"
+#include "utils/encryption.hpp"
 #include "utils/index_utils.hpp"
 #include "utils/range.hpp"
 #include "utils/string_utils.hpp"
@@ -51,6 +54,10 @@ typedef range<irs::segment_writer::update_context> update_contexts_ref;
 
 const size_t NON_UPDATE_RECORD = std::numeric_limits<size_t>::max(); // non-update
 
+// maximum number of documents of a columnar batch inserted at once if
+// a segment memory limit is set, the limit is checked between slices
+constexpr size_t BATCH_SLICE_DOCS = 4096;
+
 const irs::column_info_provider_t DEFAULT_COLUMN_INFO = [](const irs::string_ref&) {
   // no compression, no encryption
   return irs::column_info{ irs::type<irs::compression::none>::get(), {}, false };
@@ -104,31 +111,18 @@ std::vector<irs::index_file_refs::ref_t> extract_refs(
 /// @brief apply any document removals based on filters in the segment
 /// @param modifications where to get document update_contexts from
 /// @param docs_mask where to apply document removals to
-/// @param readers readers by segment name
-/// @param meta key used to get reader for the segment to evaluate
+/// @param reader the segment to evaluate
+/// @param meta segment meta to track live documents in
 /// @param min_modification_generation smallest consider modification generation
 /// @return if any new records were added (modification_queries_ modified)
 ////////////////////////////////////////////////////////////////////////////////
 bool add_document_mask_modified_records(
     modification_contexts_ref& modifications, // where to get document update_contexts from
     irs::document_mask& docs_mask, // where to apply document removals to
-    irs::readers_cache& readers, // where to get segment readers from
-    irs::segment_meta& meta, // key used to get reader for the segment to evaluate
+    const irs::sub_reader& reader, // the segment to evaluate
+    irs::segment_meta& meta, // segment meta to track live documents in
     size_t min_modification_generation = 0
 ) {
-  if (modifications.empty()) {
-    return false; // nothing new to flush
-  }
-
-  auto reader = readers.emplace(meta);
-
-  if (!reader) {
-    throw irs::index_error(irs::string_utils::to_string(
-      "while adding document mask modified records to document_mask of segment '%s', error: failed to open segment",
-      meta.name.c_str()
-    ));
-  }
-
   bool modified = false;
 
   for (auto& modification : modifications) {
@@ -171,32 +165,62 @@ bool add_document_mask_modified_records(
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief apply any document removals based on filters in the segment
 /// @param modifications where to get document update_contexts from
-/// @param segment where to apply document removals to
-/// @param min_doc_id staring doc_id that should be considered
+/// @param docs_mask where to apply document removals to
 /// @param readers readers by segment name
+/// @param meta key used to get reader for the segment to evaluate
+/// @param min_modification_generation smallest consider modification generation
 /// @return if any new records were added (modification_queries_ modified)
 ////////////////////////////////////////////////////////////////////////////////
 bool add_document_mask_modified_records(
     modification_contexts_ref& modifications, // where to get document update_contexts from
-    flush_segment_context& ctx, // where to apply document removals to
-    irs::readers_cache& readers // where to get segment readers from
+    irs::document_mask& docs_mask, // where to apply document removals to
+    irs::readers_cache& readers, // where to get segment readers from
+    irs::segment_meta& meta, // key used to get reader for the segment to evaluate
+    size_t min_modification_generation = 0
 ) {
   if (modifications.empty()) {
     return false; // nothing new to flush
   }
 
-  auto reader = readers.emplace(ctx.segment_.meta);
+  auto reader = readers.emplace(meta);
 
   if (!reader) {
     throw irs::index_error(irs::string_utils::to_string(
-      "while adding document mask modified records to flush_segment_context of segment '%s', error: failed to open segment",
-      ctx.segment_.meta.name.c_str()
+      "while adding document mask modified records to document_mask of segment '%s', error: failed to open segment",
+      meta.name.c_str()
     ));
   }
 
-  assert(irs::doc_limits::valid(ctx.doc_id_begin_));
-  assert(ctx.doc_id_begin_ <= ctx.doc_id_end_);
-  assert(ctx.doc_id_end_ <= ctx.update_contexts_.size() + irs::doc_limits::min());
+  return add_document_mask_modified_records(
+    modifications, docs_mask, reader, meta, min_modification_generation);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief apply any document removals based on filters to the documents
+///        [doc_id_begin, doc_id_end) of the segment
+/// @param modifications where to get document update_contexts from
+/// @param reader the segment to evaluate
+/// @param doc_id_begin staring doc_id that should be considered
+/// @param doc_id_end ending doc_id that should be considered
+/// @param update_contexts update contexts for documents in the segment
+/// @param update_modifications modification contexts referenced by 'update_contexts'
+/// @param docs_mask where to apply document removals to
+/// @param meta segment meta to track live documents in
+/// @return if any new records were added (modification_queries_ modified)
+////////////////////////////////////////////////////////////////////////////////
+bool add_document_mask_modified_records(
+    modification_contexts_ref& modifications, // where to get document update_contexts from
+    const irs::sub_reader& reader, // the segment to evaluate
+    size_t doc_id_begin, // starting doc_id to consider (inclusive)
+    size_t doc_id_end, // ending doc_id to consider (exclusive)
+    const update_contexts_ref& update_contexts, // update contexts for documents in the segment
+    const modification_contexts_ref& update_modifications, // modification contexts referenced by 'update_contexts'
+    irs::document_mask& docs_mask, // where to apply document removals to
+    irs::segment_meta& meta // segment meta to track live documents in
+) {
+  assert(irs::doc_limits::valid(doc_id_begin));
+  assert(doc_id_begin <= doc_id_end);
+  assert(doc_id_end <= update_contexts.size() + irs::doc_limits::min());
   bool modified = false;
 
   for (auto& modification : modifications) {
@@ -219,16 +243,16 @@ bool add_document_mask_modified_records(
     while (itr->next()) {
       const auto doc_id = itr->value();
 
-      if (doc_id < ctx.doc_id_begin_ || doc_id >= ctx.doc_id_end_) {
+      if (doc_id < doc_id_begin || doc_id >= doc_id_end) {
         continue; // doc_id is not part of the current flush_context
       }
 
-      auto& doc_ctx = ctx.update_contexts_[doc_id - irs::doc_limits::min()]; // valid because of asserts above
+      auto& doc_ctx = update_contexts[doc_id - irs::doc_limits::min()]; // valid because of asserts above
 
       // if the indexed doc_id was insert()ed after the request for modification
       // or the indexed doc_id was already masked then it should be skipped
       if (modification.generation < doc_ctx.generation
-          || !ctx.docs_mask_.insert(doc_id).second) {
+          || !docs_mask.insert(doc_id).second) {
         continue; // the current modification query does not match any records
       }
 
@@ -237,12 +261,12 @@ bool add_document_mask_modified_records(
       // for every update request a replacement 'update-value' is optimistically inserted
       if (modification.update
           && doc_ctx.update_id != NON_UPDATE_RECORD
-          && !ctx.modification_contexts_[doc_ctx.update_id].seen) {
+          && !update_modifications[doc_ctx.update_id].seen) {
         continue; // the current modification matched a replacement document which in turn did not match any records
       }
 
-      assert(ctx.segment_.meta.live_docs_count);
-      --ctx.segment_.meta.live_docs_count; // decrement count of live docs
+      assert(meta.live_docs_count);
+      --meta.live_docs_count; // decrement count of live docs
       modification.seen = true;
       modified = true;
     }
@@ -251,6 +275,80 @@ bool add_document_mask_modified_records(
   return modified;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief apply any document removals based on filters in the segment
+/// @param modifications where to get document update_contexts from
+/// @param segment where to apply document removals to
+/// @param readers readers by segment name
+/// @return if any new records were added (modification_queries_ modified)
+////////////////////////////////////////////////////////////////////////////////
+bool add_document_mask_modified_records(
+    modification_contexts_ref& modifications, // where to get document update_contexts from
+    flush_segment_context& ctx, // where to apply document removals to
+    irs::readers_cache& readers // where to get segment readers from
+) {
+  if (modifications.empty()) {
+    return false; // nothing new to flush
+  }
+
+  auto reader = readers.emplace(ctx.segment_.meta);
+
+  if (!reader) {
+    throw irs::index_error(irs::string_utils::to_string(
+      "while adding document mask modified records to flush_segment_context of segment '%s', error: failed to open segment",
+      ctx.segment_.meta.name.c_str()
+    ));
+  }
+
+  return add_document_mask_modified_records(
+    modifications, reader, ctx.doc_id_begin_, ctx.doc_id_end_,
+    ctx.update_contexts_, ctx.modification_contexts_,
+    ctx.docs_mask_, ctx.segment_.meta);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief evaluates doc_ids of a flushed segment_meta of a segment_context
+///        being a part of a flush_context
+/// @param flushed_docs_start sum of docs_count of all previous segment_meta
+/// @param flushed_docs_count sum of docs_count of all previous segment_meta
+///        including this segment_meta
+/// @param docs_mask_tail_doc_id first doc_id of the segment_meta masked due
+///        to a rollback
+/// @param doc_id_begin starting doc_id of the flush_context (inclusive)
+/// @param doc_id_end ending doc_id of the flush_context (exclusive)
+/// @return range of doc_ids in the segment_meta, empty if none
+////////////////////////////////////////////////////////////////////////////////
+std::pair<size_t, size_t> flushed_doc_id_range(
+    size_t flushed_docs_start,
+    size_t flushed_docs_count,
+    size_t docs_mask_tail_doc_id,
+    size_t doc_id_begin,
+    size_t doc_id_end) noexcept {
+  if (doc_id_end - irs::doc_limits::min() <= flushed_docs_start // segment_meta fully before the start of this flush_context
+      || doc_id_begin - irs::doc_limits::min() >= flushed_docs_count) { // segment_meta fully after the start of this flush_context
+    return { irs::doc_limits::min(), irs::doc_limits::min() };
+  }
+
+  auto update_contexts_begin = std::max( // 0-based
+    doc_id_begin - irs::doc_limits::min(),
+    flushed_docs_start
+  );
+  auto update_contexts_end = std::min( // 0-based
+    doc_id_end - irs::doc_limits::min(),
+    flushed_docs_count
+  );
+  assert(update_contexts_begin <= update_contexts_end);
+  auto valid_doc_id_begin =
+    update_contexts_begin - flushed_docs_start + irs::doc_limits::min(); // begining doc_id in this segment_meta
+  auto valid_doc_id_end = std::min(
+    update_contexts_end - flushed_docs_start + irs::doc_limits::min(),
+    docs_mask_tail_doc_id
+  );
+
+  // may be empty since head+tail == 'docs_count'
+  return { valid_doc_id_begin, std::max(valid_doc_id_begin, valid_doc_id_end) };
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief mask documents created by updates which did not have any matches
 /// @return if any new records were added (modification_contexts_ modified)
@@ -713,6 +811,89 @@ index_writer::documents_context::document::~document() noexcept {
   }
 }
 
+bool index_writer::documents_context::insert(const columnar_batch& batch) {
+  if (!batch.valid()) {
+    return false;
+  }
+
+  bool all_valid = true;
+
+  // a batch is split into slices fitting segment limits, every slice is
+  // placed into the current segment of the context which is flushed
+  // before the next slice once it reaches the limits
+  for (size_t offset = 0; offset < batch.docs;) {
+    flush_context* ctx;
+    segment_context_ptr segment;
+
+    {
+      // thread-safe to use ctx_/segment_ while have lock since active flush_context will not change
+      auto ctx_ptr = update_segment(); // updates 'segment_' and 'ctx_'
+
+      assert(ctx_ptr);
+      assert(segment_.ctx());
+      assert(segment_.ctx()->writer_);
+      ctx = ctx_ptr.get();
+      segment = segment_.ctx();
+      ++segment->active_count_;
+    }
+
+    auto clear_busy = make_finally([ctx, segment](){
+      if (!--segment->active_count_) {
+        auto lock = make_lock_guard(ctx->mutex_); // lock due to context modification and notification
+        ctx->pending_segment_context_cond_.notify_all(); // in case ctx is in flush_all()
+      }
+    });
+
+    auto& writer = *(segment->writer_);
+    const auto segment_docs_max = writer_.segment_limits_.segment_docs_max.load();
+    const auto segment_memory_max = writer_.segment_limits_.segment_memory_max.load();
+    size_t count = batch.docs - offset;
+
+    if (segment_docs_max) {
+      count = std::min(count, segment_docs_max > writer.docs_cached()
+                                ? segment_docs_max - writer.docs_cached()
+                                : size_t(1));
+    }
+
+    if (segment_memory_max) {
+      // memory consumed by a slice isn't known in advance,
+      // check the limit at least once per BATCH_SLICE_DOCS
+      count = std::min(count, BATCH_SLICE_DOCS);
+    }
+
+    auto uncomitted_doc_id_begin =
+      segment->uncomitted_doc_id_begin_ > segment->flushed_update_contexts_.size()
+      ? (segment->uncomitted_doc_id_begin_ - segment->flushed_update_contexts_.size()) // uncomitted start in 'writer_'
+      : doc_limits::min(); // uncommited start in 'flushed_'
+    assert(uncomitted_doc_id_begin <= writer.docs_cached() + doc_limits::min());
+    auto rollback_extra =
+      writer.docs_cached() + doc_limits::min() - uncomitted_doc_id_begin; // ensure reset() will be noexcept
+
+    const auto doc = writer.begin(segment->make_update_context(), count, rollback_extra);
+
+    if (doc_limits::eof(doc)) {
+      return false; // the segment cannot fit the slice
+    }
+
+    segment->buffered_docs_.store(writer.docs_cached());
+
+    try {
+      all_valid &= writer.insert(batch.slice(offset, count), doc);
+    } catch (...) {
+      // implicitly noexcept since memory reserved in the call to begin(...)
+      for (size_t i = 0; i < count; ++i) {
+        writer.remove(doc_id_t(doc + i));
+      }
+
+      throw;
+    }
+
+    offset += count;
+  }
+
+  return all_valid;
+}
+
 index_writer::documents_context::~documents_context() noexcept {
   // failure may indicate a dangling 'document' instance
   assert(segment_.ctx().use_count() >= 0 &&
@@ -1039,6 +1220,10 @@ void index_writer::flush_context::reset() noexcept {
   pending_segments_.clear();
   pending_segment_contexts_.clear();
   segment_mask_.clear();
+  nrt_modifications_.clear();
+  nrt_committed_.clear();
+  nrt_segments_.clear();
+  switched_ = false;
 }
 
 index_writer::segment_context::segment_context(
@@ -1223,6 +1408,7 @@ index_writer::index_writer(
     dir_(dir),
     flush_context_pool_(2), // 2 because just swap them due to common commit lock
     meta_(std::move(meta)),
+    commit_pool_(1, 0), // single thread preserves order of commits
     segment_limits_(segment_limits),
     segment_writer_pool_(segment_pool_size),
     segments_active_(0),
@@ -1254,7 +1440,7 @@ void index_writer::clear(uint64_t tick) {
     return; // already empty
   }
 
-  auto ctx = get_flush_context(false);
+  auto ctx = commit_flush_context(); // preserve order of commits
   auto ctx_lock = make_lock_guard(ctx->mutex_); // ensure there are no active struct update operations
 
   auto pending_commit = memory::make_shared<committed_state_t::element_type>(
@@ -1386,6 +1572,14 @@ index_writer::ptr index_writer::make(
 
 index_writer::~index_writer() noexcept {
   assert(!segments_active_.load()); // failure may indicate a dangling 'document' instance
+
+  try {
+    commit_pool_.stop(); // finish pending asynchronous commits
+  } catch (...) {
+    // NOOP
+  }
+  assert(async_commits_.empty());
+
   cached_readers_.clear();
   write_lock_.reset(); // reset write lock if any
   pending_state_.reset(); // reset pending state (if any) before destroying flush contexts
@@ -1406,6 +1600,315 @@ uint64_t index_writer::buffered_docs() const {
   return docs_in_ram;
 }
 
+index_reader::ptr index_writer::nrt_reader() {
+  REGISTER_TIMER_DETAILED();
+
+  // hold the active flush context to prevent it from being committed
+  // while its segments are being flushed
+  auto ctx = get_flush_context();
+
+  // modifications applied and segments exposed so far are reused
+  auto nrt_lock = make_lock_guard(ctx->nrt_mutex_);
+  auto& nrt_modifications = ctx->nrt_modifications_;
+  auto& nrt_segments = ctx->nrt_segments_;
+
+  auto committed_state = committed_state_helper::atomic_load(&committed_state_);
+  assert(committed_state);
+
+  // take all idle segments of the active flush context, i.e. the segments
+  // not being used by any 'documents_context'
+  std::vector<active_segment_context> segments;
+  std::vector<const flush_context::pending_segment_context*> pending_segments;
+  while (auto* node = static_cast<flush_context::pending_segment_context*>(
+           ctx->pending_segment_contexts_freelist_.pop())) {
+    segments.emplace_back(node->segment_, segments_active_, ctx.get(), node->value);
+    pending_segments.emplace_back(node);
+  }
+
+  // return segments back to the flush context
+  auto release_segments = make_finally([&ctx, &segments]()noexcept{
+    for (auto& segment : segments) {
+      try {
+        ctx->emplace(std::move(segment));
+      } catch (...) {
+        IR_FRMT_ERROR("Failed to return segment to flush context");
+      }
+    }
+  });
+
+  for (auto& entry : segments) {
+    auto& segment = *entry.ctx();
+
+    try {
+      segment.flush();
+    } catch (...) {
+      IR_FRMT_ERROR(
+        "while flushing segment '%s', error: failed to flush segment",
+        segment.writer_meta_.meta.name.c_str());
+
+      segment.reset();
+
+      throw;
+    }
+  }
+
+  // segments flushed once remain visible even if their segment_context
+  // is being used by a 'documents_context' during subsequent calls,
+  // the same applies to the modifications of such segment_context
+  {
+    auto lock = make_lock_guard(ctx->mutex_);
+
+    for (auto* pending_segment : pending_segments) {
+      auto& segment = *pending_segment->segment_;
+      auto flush_lock = make_lock_guard(segment.flush_mutex_);
+
+      auto it = std::find_if(
+        nrt_modifications.begin(), nrt_modifications.end(),
+        [&segment](const flush_context::nrt_modifications& entry) {
+          return entry.segment_ == &segment;
+      });
+
+      if (it == nrt_modifications.end()) {
+        it = nrt_modifications.emplace(it);
+        it->segment_ = &segment;
+        it->modification_offset_begin_ = pending_segment->modification_offset_begin_;
+      }
+
+      const size_t modifications_offset = std::distance(nrt_modifications.begin(), it);
+      auto& owner = *it;
+
+      // committed modifications never change, take the new ones only
+      assert(owner.modification_offset_begin_ + owner.modifications_.size() <= segment.uncomitted_modification_queries_);
+      assert(segment.uncomitted_modification_queries_ <= segment.modification_queries_.size());
+      for (auto i = owner.modification_offset_begin_ + owner.modifications_.size(),
+           end = segment.uncomitted_modification_queries_;
+           i < end;
+           ++i) {
+        auto& modification = segment.modification_queries_[i];
+        owner.modifications_.emplace_back(
+          modification.filter, modification.generation, modification.update);
+      }
+
+      // open readers for the newly flushed segments
+      size_t flushed_docs_count = 0;
+
+      for (auto& flushed : segment.flushed_) {
+        auto flushed_docs_start = flushed_docs_count;
+
+        flushed_docs_count += flushed.meta.docs_count;
+
+        const auto nrt_it = std::find_if(
+          nrt_segments.begin(), nrt_segments.end(),
+          [&flushed](const flush_context::nrt_segment& entry) {
+            return entry.meta_.name == flushed.meta.name;
+        });
+
+        if (nrt_it != nrt_segments.end() || !flushed.meta.live_docs_count) {
+          continue; // already opened or empty
+        }
+
+        const auto doc_ids = flushed_doc_id_range(
+          flushed_docs_start, flushed_docs_count, flushed.docs_mask_tail_doc_id,
+          pending_segment->doc_id_begin_,
+          std::min(segment.uncomitted_doc_id_begin_, pending_segment->doc_id_end_));
+
+        if (doc_ids.first == doc_ids.second) {
+          continue; // no documents of this flush_context
+        }
+
+        auto reader = segment_reader::open(dir_, flushed.meta);
+
+        if (!reader) {
+          throw index_error(string_utils::to_string(
+            "while opening near-real-time reader, error: failed to open segment '%s'",
+            flushed.meta.name.c_str()));
+        }
+
+        flush_context::nrt_segment nrt_segment;
+        nrt_segment.meta_ = flushed.meta;
+        nrt_segment.reader_ = std::move(reader);
+        nrt_segment.committed_ = false;
+        nrt_segment.modifications_ = modifications_offset;
+        nrt_segment.doc_id_begin_ = doc_id_t(doc_ids.first);
+        nrt_segment.doc_id_end_ = doc_id_t(doc_ids.second);
+        nrt_segment.update_contexts_.assign(
+          segment.flushed_update_contexts_.begin() + flushed_docs_start,
+          segment.flushed_update_contexts_.begin() + flushed_docs_count);
+
+        // read document_mask as was originally flushed
+        index_utils::read_document_mask(
+          nrt_segment.docs_mask_, segment.dir_, flushed.meta);
+
+        // make update ids relative to the modifications of this flush_context
+        for (size_t doc_id = doc_limits::min(),
+             doc_id_end = nrt_segment.update_contexts_.size() + doc_limits::min();
+             doc_id < doc_id_end;
+             ++doc_id) {
+          auto& doc_ctx = nrt_segment.update_contexts_[doc_id - doc_limits::min()];
+
+          if (doc_ctx.update_id == NON_UPDATE_RECORD) {
+            continue; // not an update operation
+          }
+
+          if (doc_id < doc_ids.first || doc_id >= doc_ids.second) {
+            doc_ctx.update_id = NON_UPDATE_RECORD; // not a part of this flush_context
+            continue;
+          }
+
+          assert(doc_ctx.update_id >= owner.modification_offset_begin_);
+          doc_ctx.update_id -= owner.modification_offset_begin_;
+          assert(doc_ctx.update_id < owner.modifications_.size());
+          nrt_segment.updates_.emplace_back(doc_id_t(doc_id));
+        }
+
+        nrt_segments.emplace_back(std::move(nrt_segment));
+      }
+    }
+  }
+
+  // readers of committed segments are reused as long as the segments
+  // remain unchanged
+  {
+    std::vector<flush_context::nrt_segment> nrt_committed;
+    nrt_committed.reserve(committed_state->first->size());
+
+    for (auto& segment : *committed_state->first) {
+      auto it = std::find_if(
+        ctx->nrt_committed_.begin(), ctx->nrt_committed_.end(),
+        [&segment](const flush_context::nrt_segment& entry) {
+          return entry.meta_.name == segment.meta.name
+            && entry.meta_.version == segment.meta.version;
+      });
+
+      if (it != ctx->nrt_committed_.end()) {
+        nrt_committed.emplace_back(std::move(*it));
+        continue;
+      }
+
+      auto reader = cached_readers_.emplace(segment.meta);
+
+      if (!reader) {
+        throw index_error(string_utils::to_string(
+          "while opening near-real-time reader, error: failed to open segment '%s'",
+          segment.meta.name.c_str()));
+      }
+
+      flush_context::nrt_segment nrt_segment;
+      nrt_segment.meta_ = segment.meta;
+      nrt_segment.reader_ = std::move(reader);
+      nrt_segment.committed_ = true;
+      nrt_segment.doc_id_begin_ = doc_limits::min();
+      nrt_segment.doc_id_end_ = doc_limits::eof();
+      index_utils::read_document_mask(nrt_segment.docs_mask_, dir_, segment.meta);
+
+      nrt_committed.emplace_back(std::move(nrt_segment));
+    }
+
+    ctx->nrt_committed_ = std::move(nrt_committed);
+  }
+
+  // apply the modifications not applied to a segment yet the same way as
+  // flush_all(...) does, i.e. committed segments first
+  auto mask_modified_records = [&nrt_modifications](
+      flush_context::nrt_segment& segment) {
+    const auto docs_masked = segment.docs_mask_.size();
+
+    segment.applied_.resize(nrt_modifications.size());
+
+    for (size_t i = 0, count = nrt_modifications.size(); i < count; ++i) {
+      auto& modifications = nrt_modifications[i].modifications_;
+      auto& applied = segment.applied_[i];
+
+      if (applied == modifications.size()) {
+        continue; // nothing new to apply
+      }
+
+      modification_contexts_ref modification_queries(
+        modifications.data() + applied, modifications.size() - applied);
+
+      if (segment.committed_) {
+        add_document_mask_modified_records(
+          modification_queries, segment.docs_mask_,
+          segment.reader_, segment.meta_);
+      } else {
+        auto& owner = nrt_modifications[segment.modifications_].modifications_;
+
+        add_document_mask_modified_records(
+          modification_queries, segment.reader_,
+          segment.doc_id_begin_, segment.doc_id_end_,
+          update_contexts_ref(segment.update_contexts_.data(), segment.update_contexts_.size()),
+          modification_contexts_ref(owner.data(), owner.size()),
+          segment.docs_mask_, segment.meta_);
+      }
+
+      applied = modifications.size();
+    }
+
+    return docs_masked != segment.docs_mask_.size();
+  };
+
+  std::vector<bool> masked;
+  masked.reserve(ctx->nrt_committed_.size() + nrt_segments.size());
+
+  for (auto& segment : ctx->nrt_committed_) {
+    masked.emplace_back(mask_modified_records(segment));
+  }
+
+  for (auto& segment : nrt_segments) {
+    masked.emplace_back(mask_modified_records(segment));
+  }
+
+  std::vector<segment_reader> readers;
+  readers.reserve(masked.size());
+  uint64_t docs_max = 0;
+  uint64_t docs_count = 0;
+
+  auto add_reader = [&](flush_context::nrt_segment& segment, bool modified) {
+    // mask documents created by updates which did not have any matches,
+    // an update may get matches later on, e.g. within a segment flushed
+    // by a subsequent call, hence such documents are tracked separately
+    std::vector<doc_id_t> unused_updates;
+
+    if (!segment.committed_) {
+      auto& owner = nrt_modifications[segment.modifications_].modifications_;
+
+      for (const auto doc_id : segment.updates_) {
+        auto& doc_ctx = segment.update_contexts_[doc_id - doc_limits::min()];
+
+        if (!owner[doc_ctx.update_id].seen && !segment.docs_mask_.contains(doc_id)) {
+          unused_updates.emplace_back(doc_id);
+        }
+      }
+    }
+
+    if (modified || !segment.view_ || unused_updates != segment.unused_updates_) {
+      auto docs_mask = segment.docs_mask_;
+      docs_mask.insert(unused_updates.begin(), unused_updates.end());
+
+      segment.view_ = segment.reader_.masked(
+        std::move(docs_mask), segment.doc_id_begin_, segment.doc_id_end_);
+      segment.unused_updates_ = std::move(unused_updates);
+    }
+
+    readers.emplace_back(segment.view_);
+    docs_max += segment.view_->docs_count();
+    docs_count += segment.view_->live_docs_count();
+  };
+
+  size_t i = 0;
+
+  for (auto& segment : ctx->nrt_committed_) {
+    add_reader(segment, masked[i++]);
+  }
+
+  for (auto& segment : nrt_segments) {
+    add_reader(segment, masked[i++]);
+  }
+
+  return memory::make_shared<composite_reader<segment_reader>>(
+    std::move(readers), docs_count, docs_max);
+}
+
 index_writer::consolidation_result index_writer::consolidate(
     const consolidation_policy_t& policy,
     format::ptr codec /*= nullptr*/,
@@ -1807,6 +2310,96 @@ bool index_writer::import(
   return true;
 }
 
+bool index_writer::import(
+    const directory& dir,
+    const directory_reader& reader,
+    const merge_writer::flush_progress_t& progress /*= {}*/) {
+  if (!reader.live_docs_count()) {
+    return true; // skip empty readers since no documents to import
+  }
+
+  auto& segments = reader.meta().meta;
+
+  // segment files can be copied verbatim only if they are readable as is
+  const bool copyable =
+    !comparator_ // imported segments would have to be re-sorted
+    && !get_encryption(dir.attributes()) // cipher streams are bound to file names
+    && !get_encryption(dir_.attributes())
+    && std::all_of(
+      segments.begin(), segments.end(),
+      [this](const index_meta::index_segment_t& segment) {
+        auto& meta = segment.meta;
+
+        return meta.codec && meta.codec->type() == codec_->type()
+          && std::all_of(
+            meta.files.begin(), meta.files.end(),
+            [&meta](const std::string& file) {
+              return file.size() > meta.name.size()
+                && !file.compare(0, meta.name.size(), meta.name)
+                && '.' == file[meta.name.size()];
+          });
+    });
+
+  if (!copyable) {
+    return import(reader, nullptr, progress);
+  }
+
+  std::vector<std::pair<index_meta::index_segment_t, file_refs_t>> imported;
+  imported.reserve(segments.size());
+
+  for (auto& source : segments) {
+    if (!source.meta.live_docs_count) {
+      continue; // skip segments without live documents
+    }
+
+    ref_tracking_directory tracking_dir(dir_); // track references
+
+    index_meta::index_segment_t segment;
+    auto& meta = segment.meta;
+    meta = source.meta;
+    meta.name = file_name(meta_.increment());
+    meta.codec = codec_;
+    meta.size = 0; // computed by 'flush_index_segment(...)'
+    meta.files.clear();
+    meta.files.reserve(source.meta.files.size());
+
+    for (auto& file : source.meta.files) {
+      if (progress && !progress()) {
+        return false; // import aborted (copied files are unreferenced)
+      }
+
+      // only a segment name prefix is remapped, file names derived
+      // from a segment name and version remain valid
+      auto name = meta.name;
+      name.append(file, source.meta.name.size(), std::string::npos);
+
+      if (!directory_utils::copy(dir, file, tracking_dir, name)) {
+        return false; // import failure (copied files are unreferenced)
+      }
+
+      meta.files.emplace(std::move(name));
+    }
+
+    index_utils::flush_index_segment(tracking_dir, segment);
+    imported.emplace_back(std::move(segment), extract_refs(tracking_dir));
+  }
+
+  auto ctx = get_flush_context();
+  auto lock = make_lock_guard(ctx->mutex_); // lock due to context modification
+  const auto generation = ctx->generation_.load(); // current modification generation
+  ctx->pending_segments_.reserve(ctx->pending_segments_.size() + imported.size());
+
+  for (auto& [segment, refs] : imported) {
+    ctx->pending_segments_.emplace_back(
+      std::move(segment),
+      generation,
+      std::move(refs) // do not forget to track refs
+    );
+  }
+
+  return true;
+}
+
 index_writer::flush_context_ptr index_writer::get_flush_context(bool shared /*= true*/) {
   auto* ctx = flush_context_.load(); // get current ctx
 
@@ -1822,6 +2415,7 @@ index_writer::flush_context_ptr index_writer::get_flush_context(bool shared /*=
       }
 
       lock.release();
+      ctx->switched_ = true;
 
       return {
         ctx,
@@ -1867,6 +2461,28 @@ index_writer::flush_context_ptr index_writer::get_flush_context(bool shared /*=
   }
 }
 
+index_writer::flush_context_ptr index_writer::switch_flush_context() {
+  auto exclusive_ctx = get_flush_context(false);
+
+  // write-locks of 'read_write_mutex' are bound to the locking thread,
+  // downgrade to a read-lock which may be released by any thread, the
+  // context is no longer active hence update operations won't pick it up,
+  // it becomes active again only after being flushed and released
+  auto* ctx = exclusive_ctx.release();
+  async_utils::read_write_mutex::write_mutex mutex(ctx->flush_mutex_);
+  mutex.unlock(true);
+
+  return {
+    ctx,
+    [](flush_context* ctx) noexcept ->void {
+      async_utils::read_write_mutex::read_mutex mutex(ctx->flush_mutex_);
+      auto lock = make_unique_lock(mutex, std::adopt_lock);
+
+      ctx->reset(); // reset context and make ready for reuse
+    }
+  };
+}
+
 index_writer::active_segment_context index_writer::get_segment_context(
     flush_context& ctx) {
   // release reservation (delcare before aquisition since operator++() is noexcept)
@@ -1921,7 +2537,7 @@ index_writer::active_segment_context index_writer::get_segment_context(
   return active_segment_context(segment_ctx, segments_active_);
 }
 
-index_writer::pending_context_t index_writer::flush_all() {
+index_writer::pending_context_t index_writer::flush_all(flush_context_ptr&& ctx) {
   REGISTER_TIMER_DETAILED();
   using namespace std::chrono_literals;
 
@@ -1932,7 +2548,7 @@ index_writer::pending_context_t index_writer::flush_all() {
   auto pending_meta = memory::make_unique<index_meta>();
   auto& segments = pending_meta->segments_;
 
-  auto ctx = get_flush_context(false);
+  assert(ctx);
   auto& dir = *(ctx->dir_);
   std::vector<std::unique_lock<decltype(segment_context::flush_mutex_)>> segment_flush_locks;
   auto lock = make_unique_lock(ctx->mutex_); // ensure there are no active struct update operations
@@ -2247,31 +2863,18 @@ index_writer::pending_context_t index_writer::flush_all() {
 
         flushed_docs_count += flushed.meta.docs_count; // sum of all previous segment_meta::docs_count including this meta
 
-        if (!flushed.meta.live_docs_count // empty segment_meta
-            || flushed_doc_id_end - doc_limits::min() <= flushed_docs_start // segment_meta fully before the start of this flush_context
-            || pending_segment_context.doc_id_begin_ - doc_limits::min() >= flushed_docs_count) { // segment_meta fully after the start of this flush_context
+        if (!flushed.meta.live_docs_count) { // empty segment_meta
           continue;
         }
 
-        auto update_contexts_begin = std::max( // 0-based
-          pending_segment_context.doc_id_begin_ - doc_limits::min(),
-          flushed_docs_start
-        );
-        auto update_contexts_end = std::min( // 0-based
-          flushed_doc_id_end - doc_limits::min(),
-          flushed_docs_count
-        );
-        assert(update_contexts_begin <= update_contexts_end);
-        auto valid_doc_id_begin =
-          update_contexts_begin - flushed_docs_start + doc_limits::min(); // begining doc_id in this segment_meta
-        auto valid_doc_id_end = std::min(
-          update_contexts_end - flushed_docs_start + doc_limits::min(),
-          size_t(flushed.docs_mask_tail_doc_id)
-        );
-        assert(valid_doc_id_begin <= valid_doc_id_end);
+        const auto valid_doc_ids = flushed_doc_id_range(
+          flushed_docs_start, flushed_docs_count, flushed.docs_mask_tail_doc_id,
+          pending_segment_context.doc_id_begin_, flushed_doc_id_end);
+        const auto valid_doc_id_begin = valid_doc_ids.first; // begining doc_id in this segment_meta
+        const auto valid_doc_id_end = valid_doc_ids.second;
 
         if (valid_doc_id_begin == valid_doc_id_end) {
-          continue; // empty segment since head+tail == 'docs_count'
+          continue; // no documents of this flush_context or empty segment since head+tail == 'docs_count'
         }
 
         modification_contexts_ref segment_modification_contexts(
@@ -2403,15 +3006,22 @@ index_writer::pending_context_t index_writer::flush_all() {
 bool index_writer::start() {
   assert(!commit_lock_.try_lock()); // already locked
 
-  REGISTER_TIMER_DETAILED();
-
   if (pending_state_) {
     // begin has been already called
     // without corresponding call to commit
     return false;
   }
 
-  auto to_commit = flush_all();
+  return start(commit_flush_context());
+}
+
+bool index_writer::start(flush_context_ptr&& ctx) {
+  assert(!commit_lock_.try_lock()); // already locked
+  assert(!pending_state_);
+
+  REGISTER_TIMER_DETAILED();
+
+  auto to_commit = flush_all(std::move(ctx));
 
   if (!to_commit) {
     // nothing to commit, no transaction started
@@ -2430,21 +3040,29 @@ bool index_writer::start() {
     meta_.update_generation(pending_meta);
   });
 
-  auto sync = [&dir](const std::string& file) {
-    if (!dir.sync(file)) {
+  try {
+    // sync all pending files at once, allow directory to batch requests
+    std::vector<std::reference_wrapper<const std::string>> files;
+    to_commit.to_sync.visit([&files](const std::string& file) {
+      files.emplace_back(file);
+      return true;
+    }, pending_meta);
+
+    if (!dir.sync_files({ files.data(), files.size() })) {
+      // find out a failing file, batched call doesn't report it
+      for (const std::string& file : files) {
+        if (!dir.sync(file)) {
+          throw io_error(string_utils::to_string(
+            "failed to sync file, path: %s",
+            file.c_str()
+          ));
+        }
+      }
+
       throw io_error(string_utils::to_string(
-        "failed to sync file, path: %s",
-        file.c_str()
-      ));
+        "failed to sync " IR_SIZE_T_SPECIFIER " files", files.size()));
     }
 
-    return true;
-  };
-
-  try {
-    // sync all pending files
-    to_commit.to_sync.visit(sync, pending_meta);
-
     // track all refs
     file_refs_t pending_refs;
     append_segments_refs(pending_refs, dir, pending_meta);
@@ -2477,6 +3095,96 @@ bool index_writer::start() {
   return true;
 }
 
+void index_writer::finish_async_commits() {
+  assert(!commit_lock_.try_lock()); // already locked
+
+  for (;;) {
+    async_commit_t commit;
+
+    {
+      auto lock = make_lock_guard(async_commits_lock_);
+
+      if (async_commits_.empty()) {
+        return;
+      }
+
+      commit = std::move(async_commits_.front());
+      async_commits_.pop_front();
+    }
+
+    try {
+      finish(); // commit the transaction started by begin() if any
+
+      if (!commit.ctx) {
+        // previous commits are done, the next context is free now
+        auto lock = make_lock_guard(async_commits_lock_);
+        commit.ctx = get_flush_context(false);
+      }
+
+      const bool modified = start(std::move(commit.ctx));
+      finish();
+      commit.result.set_value(modified);
+    } catch (...) {
+      commit.result.set_exception(std::current_exception());
+    }
+  }
+}
+
+index_writer::flush_context_ptr index_writer::commit_flush_context() {
+  assert(!commit_lock_.try_lock()); // already locked
+
+  // flush contexts form a ring, contexts switched by commit_async()
+  // have to be released before the active one may be switched again
+  for (;;) {
+    finish_async_commits();
+
+    auto lock = make_lock_guard(async_commits_lock_);
+
+    if (async_commits_.empty()) {
+      return get_flush_context(false);
+    }
+  }
+}
+
+std::future<bool> index_writer::commit_async() {
+  std::promise<bool> result;
+  auto future = result.get_future();
+
+  {
+    auto lock = make_lock_guard(async_commits_lock_);
+
+    // don't wait for a previous commit to release the next context,
+    // defer switching to the commit pool instead
+    flush_context_ptr ctx{ nullptr, nullptr };
+
+    if (!flush_context_.load()->next_context_->switched_) {
+      // switch context on the current thread, the commit pool gets a shared hold
+      ctx = switch_flush_context();
+    }
+
+    async_commits_.push_back({ std::move(ctx), std::move(result) });
+  }
+
+  bool scheduled = false;
+
+  try {
+    scheduled = commit_pool_.run([this]() {
+      auto lock = make_lock_guard(commit_lock_);
+      finish_async_commits();
+    });
+  } catch (...) {
+    // NOOP
+  }
+
+  if (!scheduled) {
+    IR_FRMT_WARN("Failed to schedule asynchronous commit, committing synchronously");
+    auto lock = make_lock_guard(commit_lock_);
+    finish_async_commits();
+  }
+
+  return future;
+}
+
 void index_writer::finish() {
   assert(!commit_lock_.try_lock()); // already locked
 
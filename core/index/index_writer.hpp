@@ -25,6 +25,8 @@
 #define IRESEARCH_INDEX_WRITER_H
 
 #include <atomic>
+#include <deque>
+#include <future>
 
 #include <absl/container/flat_hash_map.h>
 
@@ -220,6 +222,17 @@ class IRESEARCH_API index_writer
         segment_.ctx()->make_update_context());
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief insert a column-oriented batch of documents into the index,
+    ///        a batch is split into slices so as to respect segment limits,
+    ///        i.e. documents of a batch may be placed into several segments
+    /// @note the changes are not visible until commit()
+    /// @return true if all documents were successfully inserted, documents
+    ///         failed to be inserted are rolled back, nothing is inserted
+    ///         if the batch is not valid
+    ////////////////////////////////////////////////////////////////////////////
+    bool insert(const columnar_batch& batch);
+
     ////////////////////////////////////////////////////////////////////////////
     /// @brief marks all documents matching the filter for removal
     /// @param filter the filter selecting which documents should be removed
@@ -638,6 +651,26 @@ class IRESEARCH_API index_writer
     format::ptr codec = nullptr,
     const merge_writer::flush_progress_t& progress = {});
 
+  ////////////////////////////////////////////////////////////////////////////
+  /// @brief imports segments of the specified reader into new segments by
+  ///        copying their files verbatim, i.e. without re-indexing, only
+  ///        file names are remapped, documents masked in the reader remain
+  ///        masked
+  /// @param dir the directory the reader is opened over
+  /// @param reader the index reader to import
+  /// @param progress callback triggered before copying every file, if the
+  ///        callback returns false then import is aborted
+  /// @note falls back to 'import(reader, nullptr, progress)' if segments
+  ///       can't be copied verbatim, i.e. a format of any segment differs
+  ///       from the writer's one, the writer sorts segments or any of
+  ///       the directories is encrypted
+  /// @returns true on success
+  ////////////////////////////////////////////////////////////////////////////
+  bool import(
+    const directory& dir,
+    const directory_reader& reader,
+    const merge_writer::flush_progress_t& progress = {});
+
   ////////////////////////////////////////////////////////////////////////////
   /// @brief opens new index writer
   /// @param dir directory where index will be should reside
@@ -703,6 +736,39 @@ class IRESEARCH_API index_writer
     return modified;
   }
 
+  ////////////////////////////////////////////////////////////////////////////
+  /// @brief make all buffered changes visible for readers in background
+  /// @return future holding whether any changes were committed
+  /// @note the active flush context is switched before returning, i.e. the
+  ///       changes made after the call belong to the next commit while
+  ///       the switched context is flushed and published by a background
+  ///       thread
+  /// @note commits are published in order of invocation, any subsequent
+  ///       begin()/commit()/clear() call finishes previously started
+  ///       asynchronous commits first
+  /// @note the call never waits for previous commits, if the context to
+  ///       switch to is still awaiting a previous commit (or a transaction
+  ///       started by begin()), the commit switches the active context only
+  ///       once the previous ones are done and then also covers changes made
+  ///       after the call
+  ////////////////////////////////////////////////////////////////////////////
+  std::future<bool> commit_async();
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// @brief opens a near-real-time reader over the last committed state and
+  ///        the documents buffered by the writer so far
+  /// @note buffered documents are flushed into segments which are then picked
+  ///       up by the next commit as is, i.e. without writing them again,
+  ///       such segments are not synced until the next commit
+  /// @note operations of segments being used by 'documents_context' instances
+  ///       at the time of the call are not visible, removals and updates of
+  ///       the other segments are applied to the returned reader
+  /// @note subsequent calls until the next commit reuse the state of the
+  ///       previous ones, i.e. only the segments and the modifications
+  ///       added since then are evaluated
+  ////////////////////////////////////////////////////////////////////////////
+  index_reader::ptr nrt_reader();
+
   ////////////////////////////////////////////////////////////////////////////
   /// @brief clears index writer's reader cache
   ////////////////////////////////////////////////////////////////////////////
@@ -979,11 +1045,37 @@ class IRESEARCH_API index_writer
     async_utils::read_write_mutex flush_mutex_; // guard for the current context during flush (write) operations vs update (read)
     std::mutex mutex_; // guard for the current context during struct update operations, e.g. pending_segments_, pending_segment_contexts_
     flush_context* next_context_; // the next context to switch to
+    std::atomic<bool> switched_{ false }; // switched out and awaiting release, i.e. can't become active again
     std::vector<import_context> pending_segments_; // complete segments to be added during next commit (import)
     std::condition_variable pending_segment_context_cond_; // notified when a segment has been freed (guarded by mutex_)
     std::deque<pending_segment_context> pending_segment_contexts_; // segment writers with data pending for next commit (all segments that have been used by this flush_context) must be std::deque to garantee that element memory location does not change for use with 'pending_segment_contexts_freelist_'
     freelist_t pending_segment_contexts_freelist_; // entries from 'pending_segment_contexts_' that are available for reuse
     absl::flat_hash_set<readers_cache::key_t, readers_cache::key_hash_t> segment_mask_; // set of segment names to be removed from the index upon commit
+    struct nrt_modifications {
+      const segment_context* segment_; // segment_context the modifications are taken from
+      size_t modification_offset_begin_; // offset of the first modification in segment_context::modification_queries_
+      std::vector<modification_context> modifications_; // committable modifications of the segment_context taken so far, 'seen' is tracked by nrt_reader() only
+    };
+
+    struct nrt_segment {
+      segment_meta meta_; // 'live_docs_count' reflects 'docs_mask_'
+      segment_reader reader_; // reader of the segment as it was flushed or committed
+      segment_reader view_; // 'reader_' as exposed by the last nrt_reader() call
+      document_mask docs_mask_; // documents removed by the modifications applied so far
+      std::vector<size_t> applied_; // number of modifications applied so far, by offset into 'nrt_modifications_'
+      bool committed_; // a segment of the last committed state, the fields below are set for flushed segments only
+      size_t modifications_; // offset into 'nrt_modifications_' of the segment_context that flushed the segment
+      doc_id_t doc_id_begin_; // first doc_id of the segment that is a part of this flush_context
+      doc_id_t doc_id_end_; // past last doc_id of the segment that is a part of this flush_context
+      std::vector<segment_writer::update_context> update_contexts_; // update_contexts of the segment documents, 'update_id' is relative to 'modifications_'
+      std::vector<doc_id_t> updates_; // documents created by updates within [doc_id_begin_, doc_id_end_)
+      std::vector<doc_id_t> unused_updates_; // documents of 'updates_' masked by the last nrt_reader() call
+    };
+
+    std::mutex nrt_mutex_; // serializes nrt_reader() calls, guard for 'nrt_modifications_' and 'nrt_segments_'
+    std::vector<nrt_modifications> nrt_modifications_; // modifications applied by nrt_reader()
+    std::vector<nrt_segment> nrt_committed_; // committed segments exposed by the last nrt_reader() call
+    std::vector<nrt_segment> nrt_segments_; // flushed segments exposed by nrt_reader()
 
     flush_context() = default;
 
@@ -1091,6 +1183,11 @@ class IRESEARCH_API index_writer
   static_assert(std::is_nothrow_move_constructible_v<pending_state_t>);
   static_assert(std::is_nothrow_move_assignable_v<pending_state_t>);
 
+  struct async_commit_t {
+    flush_context_ptr ctx{ nullptr, nullptr }; // switched flush context awaiting commit, nullptr to switch the active one once previous commits are done
+    std::promise<bool> result;
+  }; // async_commit_t
+
   index_writer(
     index_lock::ptr&& lock, 
     index_file_refs::ref_t&& lock_file_ref,
@@ -1106,12 +1203,16 @@ class IRESEARCH_API index_writer
     index_meta&& meta,
     committed_state_t&& committed_state);
 
-  pending_context_t flush_all();
+  pending_context_t flush_all(flush_context_ptr&& ctx);
 
   flush_context_ptr get_flush_context(bool shared = true);
+  flush_context_ptr switch_flush_context(); // switch active context, return the previous one to be released by any thread
   active_segment_context get_segment_context(flush_context& ctx); // return a usable segment or a nullptr segment if retry is required (e.g. no free segments available)
 
   bool start(); // starts transaction
+  bool start(flush_context_ptr&& ctx); // starts transaction for a switched flush context
+  void finish_async_commits(); // commits flush contexts switched by commit_async()
+  flush_context_ptr commit_flush_context(); // finishes asynchronous commits and exclusively acquires the active context
   void finish(); // finishes transaction
   void abort(); // aborts transaction
 
@@ -1132,6 +1233,9 @@ class IRESEARCH_API index_writer
   std::atomic<flush_context*> flush_context_; // currently active context accumulating data to be processed during the next flush
   index_meta meta_; // latest/active state of index metadata
   pending_state_t pending_state_; // current state awaiting commit completion
+  std::mutex async_commits_lock_; // guard for async_commits_ and for switching of flush contexts
+  std::deque<async_commit_t> async_commits_; // asynchronous commits in order of invocation (guarded by async_commits_lock_)
+  async_utils::thread_pool commit_pool_; // executes asynchronous commits
   segment_limits segment_limits_; // limits for use with respect to segments
   segment_pool_t segment_writer_pool_; // a cache of segments available for reuse
   std::atomic<size_t> segments_active_; // number of segments currently in use by the writer
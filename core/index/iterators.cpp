@@ -189,6 +189,21 @@ doc_iterator::ptr doc_iterator::empty() {
   return memory::to_managed<doc_iterator, false>(&EMPTY_DOC_ITERATOR);
 }
 
+size_t doc_iterator::next_batch(doc_id_t* docs, uint32_t* freqs, size_t size) {
+  const auto* freq = freqs ? irs::get<frequency>(*this) : nullptr;
+
+  size_t count = 0;
+  for (; count < size && next(); ++count) {
+    docs[count] = value();
+
+    if (freq) {
+      freqs[count] = freq->value;
+    }
+  }
+
+  return count;
+}
+
 // ----------------------------------------------------------------------------
 // --SECTION--                                                   field_iterator 
 // ----------------------------------------------------------------------------
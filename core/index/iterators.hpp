@@ -65,6 +65,26 @@ struct IRESEARCH_API doc_iterator
   /// (for more information see class description)
   //////////////////////////////////////////////////////////////////////////////
   virtual doc_id_t seek(doc_id_t target) = 0;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief advance iterator by up to 'size' documents at once, same as
+  ///        calling `next()` for every document returned
+  /// @param docs[out] buffer for document ids, holds at least 'size' values
+  /// @param freqs[out] optional buffer for term frequencies, filled only in
+  ///        case if iterator exposes `frequency` attribute
+  /// @returns number of documents read, iterator is exhausted if the
+  ///          number is less than 'size'
+  /// @note `value()` and attributes refer to the last document read unless
+  ///       iterator is exhausted
+  /// @note default implementation falls back to `next()`
+  //////////////////////////////////////////////////////////////////////////////
+  virtual size_t next_batch(doc_id_t* docs, uint32_t* freqs, size_t size);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if `next_batch(...)` is implemented natively, i.e. it's
+  ///          cheaper than calling `next()` for every document
+  //////////////////////////////////////////////////////////////////////////////
+  virtual bool has_native_batch() const noexcept { return false; }
 }; // doc_iterator
 
 //////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <absl/container/flat_hash_map.h>
 
 #include "merge_writer.hpp"
+#include "analysis/shingle_token_stream.hpp"
 #include "analysis/token_attributes.hpp"
 #include "index/comparer.hpp"
 #include "index/field_meta.hpp"
@@ -58,6 +59,13 @@ bool is_subset_of(const feature_map_t& lhs, const feature_map_t& rhs) noexcept {
   return true;
 }
 
+// shingles have to cover either all documents of a field or none of them,
+// otherwise phrases evaluated via shingles would miss matches
+bool has_same_shingles(const feature_map_t& lhs, const feature_map_t& rhs) noexcept {
+  const auto type = irs::type<phrase_shingles>::id();
+  return lhs.count(type) == rhs.count(type);
+}
+
 void accumulate_features(feature_set_t& accum, const feature_map_t& features) {
   for (auto& entry : features) {
     accum.emplace(entry.first);
@@ -845,7 +853,8 @@ bool compute_field_meta(
     // validate field_meta equivalence
     if (!is_new &&
         (!is_subset_of(field_meta.index_features, field_meta_it->second->index_features) ||
-        !is_subset_of(field_meta.features, field_meta_it->second->features))) {
+        !is_subset_of(field_meta.features, field_meta_it->second->features) ||
+        !has_same_shingles(field_meta.features, field_meta_it->second->features))) {
       return false; // field_meta is not equal, so cannot merge segments
     }
 
@@ -1010,12 +1019,13 @@ class sorting_compound_column_iterator : util::noncopyable {
   }
 
   explicit sorting_compound_column_iterator(const comparer& comparator)
-    : heap_it_(min_heap_context(itrs_, comparator)) {
+    : heap_it_(min_heap_context(itrs_, keys_, comparator)) {
   }
 
   void reset(iterators_t&& itrs) {
     heap_it_.reset(itrs.size());
     itrs_ = std::move(itrs);
+    keys_.resize(itrs_.size());
   }
 
   bool next() {
@@ -1031,20 +1041,41 @@ class sorting_compound_column_iterator : util::noncopyable {
    public:
     explicit min_heap_context(
         std::vector<iterator_t>& itrs,
+        std::vector<bstring>& keys,
         const comparer& less) noexcept
-      : itrs_(&itrs), less_(&less) {
+      : itrs_(&itrs), keys_(&keys), less_(&less),
+        normalized_(less.has_normalizer()) {
     }
 
     // advance
     bool operator()(const size_t i) const {
       assert(i < itrs_->size());
-      return (*itrs_)[i].first->next();
+      auto& it = (*itrs_)[i];
+
+      if (!it.first->next()) {
+        return false;
+      }
+
+      if (normalized_) {
+        // normalize once per value instead of once per comparison
+        assert(i < keys_->size());
+        auto& key = (*keys_)[i];
+        key.clear();
+        less_->normalize(it.second->value, key);
+      }
+
+      return true;
     }
 
     // compare
     bool operator()(const size_t lhs, const size_t rhs) const {
       assert(lhs < itrs_->size());
       assert(rhs < itrs_->size());
+
+      if (normalized_) {
+        return bytes_ref((*keys_)[rhs]) < bytes_ref((*keys_)[lhs]);
+      }
+
       const auto& lhs_value = (*itrs_)[lhs].second->value;
       const auto& rhs_value = (*itrs_)[rhs].second->value;
       return (*less_)(rhs_value, lhs_value);
@@ -1052,10 +1083,13 @@ class sorting_compound_column_iterator : util::noncopyable {
 
    private:
     std::vector<iterator_t>* itrs_;
+    std::vector<bstring>* keys_; // normalized keys of current values
     const comparer* less_;
+    bool normalized_;
   }; // min_heap_context
 
   std::vector<iterator_t> itrs_;
+  std::vector<bstring> keys_;
   external_heap_iterator<min_heap_context> heap_it_;
 }; // sorting_compound_column_iterator
 
@@ -181,6 +181,71 @@ class masked_docs_iterator
   doc_id_t next_;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class masked_range_doc_iterator
+/// @brief iterates over documents of a wrapped iterator located within
+///        [begin, end) and not present in a specified mask
+////////////////////////////////////////////////////////////////////////////////
+class masked_range_doc_iterator final
+    : public doc_iterator,
+      private util::noncopyable {
+ public:
+  masked_range_doc_iterator(
+      doc_iterator::ptr&& it,
+      doc_id_t begin,
+      doc_id_t end,
+      const document_mask& mask) noexcept
+    : it_(std::move(it)),
+      mask_(mask),
+      begin_(begin),
+      end_(end) {
+    assert(it_);
+  }
+
+  virtual bool next() override {
+    if (doc_limits::eof(doc_.value)) {
+      return false;
+    }
+
+    const auto doc = doc_limits::valid(doc_.value)
+      ? (it_->next() ? it_->value() : doc_limits::eof())
+      : it_->seek(begin_);
+
+    return !doc_limits::eof(accept(doc));
+  }
+
+  virtual doc_id_t seek(doc_id_t target) override {
+    if (target <= doc_.value) {
+      return doc_.value;
+    }
+
+    return accept(it_->seek(std::max(target, begin_)));
+  }
+
+  virtual doc_id_t value() const noexcept override {
+    return doc_.value;
+  }
+
+  virtual attribute* get_mutable(irs::type_info::type_id type) noexcept override {
+    return irs::type<document>::id() == type ? &doc_ : it_->get_mutable(type);
+  }
+
+ private:
+  doc_id_t accept(doc_id_t doc) {
+    while (doc < end_ && mask_.contains(doc)) {
+      doc = it_->next() ? it_->value() : doc_limits::eof();
+    }
+
+    return doc_.value = (doc < end_ ? doc : doc_limits::eof());
+  }
+
+  document doc_;
+  doc_iterator::ptr it_;
+  const document_mask& mask_; // excluded document ids
+  const doc_id_t begin_; // first valid doc_id
+  const doc_id_t end_; // past last valid doc_id
+}; // masked_range_doc_iterator
+
 bool read_columns_meta(
     const format& codec,
     const directory& dir,
@@ -284,6 +349,12 @@ class segment_reader_impl : public sub_reader {
     return memory::make_managed<mask_doc_iterator>(std::move(it), docs_mask_);
   }
 
+  virtual bool live(doc_id_t doc) const override {
+    return doc_limits::valid(doc) &&
+           doc < doc_limits::min() + docs_count_ &&
+           !docs_mask_.contains(doc);
+  }
+
   virtual const term_reader* field(const string_ref& name) const override {
     return field_reader_->field(name);
   }
@@ -336,6 +407,103 @@ class segment_reader_impl : public sub_reader {
     uint64_t docs_count);
 };
 
+// -------------------------------------------------------------------
+// masked_segment_reader_impl
+// -------------------------------------------------------------------
+
+class masked_segment_reader_impl final : public sub_reader {
+ public:
+  masked_segment_reader_impl(
+      std::shared_ptr<const sub_reader>&& impl,
+      document_mask&& docs_mask,
+      doc_id_t doc_id_begin,
+      doc_id_t doc_id_end,
+      uint64_t live_docs_count) noexcept
+    : impl_(std::move(impl)),
+      docs_mask_(std::move(docs_mask)),
+      live_docs_count_(live_docs_count),
+      doc_id_begin_(doc_id_begin),
+      doc_id_end_(doc_id_end) {
+    assert(impl_);
+  }
+
+  const std::shared_ptr<const sub_reader>& impl() const noexcept {
+    return impl_;
+  }
+
+  virtual const column_meta* column(const string_ref& name) const override {
+    return impl_->column(name);
+  }
+
+  virtual column_iterator::ptr columns() const override {
+    return impl_->columns();
+  }
+
+  using sub_reader::docs_count;
+  virtual uint64_t docs_count() const override {
+    return impl_->docs_count();
+  }
+
+  virtual doc_iterator::ptr docs_iterator() const override {
+    return memory::make_managed<masked_range_doc_iterator>(
+      impl_->docs_iterator(), doc_id_begin_, doc_id_end_, docs_mask_);
+  }
+
+  virtual doc_iterator::ptr mask(doc_iterator::ptr&& it) const override {
+    it = impl_->mask(std::move(it));
+
+    if (!it) {
+      return nullptr;
+    }
+
+    return memory::make_managed<masked_range_doc_iterator>(
+      std::move(it), doc_id_begin_, doc_id_end_, docs_mask_);
+  }
+
+  virtual bool live(doc_id_t doc) const override {
+    return doc >= doc_id_begin_ && doc < doc_id_end_
+      && impl_->live(doc) && !docs_mask_.contains(doc);
+  }
+
+  virtual const term_reader* field(const string_ref& name) const override {
+    return impl_->field(name);
+  }
+
+  virtual field_iterator::ptr fields() const override {
+    return impl_->fields();
+  }
+
+  virtual uint64_t live_docs_count() const override {
+    return live_docs_count_;
+  }
+
+  virtual const sub_reader& operator[](size_t i) const noexcept override {
+    assert(!i);
+    UNUSED(i);
+    return *this;
+  }
+
+  virtual size_t size() const noexcept override {
+    return 1; // only 1 segment
+  }
+
+  virtual const columnstore_reader::column_reader* sort() const override {
+    return impl_->sort();
+  }
+
+  virtual const columnstore_reader::column_reader* column_reader(
+      field_id field) const override {
+    return impl_->column_reader(field);
+  }
+
+ private:
+  std::shared_ptr<const sub_reader> impl_; // masked reader
+  document_mask docs_mask_; // documents excluded in addition to 'impl_' ones
+  uint64_t live_docs_count_;
+  doc_id_t doc_id_begin_; // first visible doc_id
+  doc_id_t doc_id_end_; // past last visible doc_id
+}; // masked_segment_reader_impl
+
 segment_reader::segment_reader(impl_ptr&& impl) noexcept
   : impl_(std::move(impl)) {
 }
@@ -379,6 +547,11 @@ segment_reader segment_reader::reopen(const segment_meta& meta) const {
   // make a copy
   impl_ptr impl = atomic_utils::atomic_load(&impl_);
 
+  // documents masked via 'masked(...)' are not a part of 'meta'
+  if (auto* masked = dynamic_cast<const masked_segment_reader_impl*>(impl.get())) {
+    return segment_reader(impl_ptr(masked->impl())).reopen(meta);
+  }
+
 #ifdef IRESEARCH_DEBUG
   auto& reader_impl = dynamic_cast<const segment_reader_impl&>(*impl);
 #else
@@ -391,6 +564,54 @@ segment_reader segment_reader::reopen(const segment_meta& meta) const {
     : segment_reader_impl::open(reader_impl.dir(), meta);
 }
 
+segment_reader segment_reader::masked(
+    document_mask&& docs_mask,
+    doc_id_t doc_id_begin /*= doc_limits::min()*/,
+    doc_id_t doc_id_end /*= doc_limits::eof()*/) const {
+  // make a copy
+  impl_ptr impl = atomic_utils::atomic_load(&impl_);
+  assert(impl);
+
+  const uint64_t docs_end = impl->docs_count() + doc_limits::min();
+  doc_id_end = doc_id_t(std::min(uint64_t(doc_id_end), docs_end));
+  doc_id_begin = std::max(std::min(doc_id_begin, doc_id_end), doc_limits::min());
+
+  // keep only documents live in 'impl' and within the range
+  // to track 'live_docs_count()'
+  for (auto it = docs_mask.begin(); it != docs_mask.end(); ) {
+    if (*it >= doc_id_begin && *it < doc_id_end && impl->live(*it)) {
+      ++it;
+    } else {
+      docs_mask.erase(it++);
+    }
+  }
+
+  // live documents of 'impl' outside of the range
+  uint64_t excluded = 0;
+
+  if (impl->live_docs_count() == impl->docs_count()) {
+    excluded = docs_end - doc_id_end + doc_id_begin - doc_limits::min();
+  } else {
+    for (doc_id_t doc = doc_limits::min(); doc < doc_id_begin; ++doc) {
+      excluded += impl->live(doc);
+    }
+
+    for (uint64_t doc = doc_id_end; doc < docs_end; ++doc) {
+      excluded += impl->live(doc_id_t(doc));
+    }
+  }
+
+  if (docs_mask.empty() && !excluded) {
+    return *this;
+  }
+
+  const auto live_docs_count = impl->live_docs_count() - docs_mask.size() - excluded;
+
+  return segment_reader(memory::make_shared<masked_segment_reader_impl>(
+    std::move(impl), std::move(docs_mask),
+    doc_id_begin, doc_id_end, live_docs_count));
+}
+
 // -------------------------------------------------------------------
 // segment_reader_impl
 // -------------------------------------------------------------------
@@ -92,6 +92,10 @@ class IRESEARCH_API segment_reader final
     return impl_->mask(std::move(it));
   }
 
+  virtual bool live(doc_id_t doc) const override {
+    return impl_->live(doc);
+  }
+
   virtual const term_reader* field(const string_ref& name) const override {
     return impl_->field(name);
   }
@@ -106,6 +110,17 @@ class IRESEARCH_API segment_reader final
 
   segment_reader reopen(const segment_meta& meta) const;
 
+  ////////////////////////////////////////////////////////////////////////////////
+  /// @return a reader sharing the data of this reader with the documents from
+  ///         'docs_mask' and the documents outside of [doc_id_begin, doc_id_end)
+  ///         additionally excluded, e.g. documents removed by operations not
+  ///         committed yet
+  ////////////////////////////////////////////////////////////////////////////////
+  segment_reader masked(
+    document_mask&& docs_mask,
+    doc_id_t doc_id_begin = doc_limits::min(),
+    doc_id_t doc_id_end = doc_limits::eof()) const;
+
   void reset() noexcept {
     impl_.reset();
   }
@@ -52,10 +52,108 @@ inline bool is_subset_of(
   return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class terms_token_stream
+/// @brief emits pre-tokenized terms of a document one per position
+////////////////////////////////////////////////////////////////////////////////
+class terms_token_stream final : public token_stream {
+ public:
+  virtual attribute* get_mutable(type_info::type_id type) noexcept override {
+    return irs::get_mutable(attrs_, type);
+  }
+
+  virtual bool next() noexcept override {
+    if (begin_ == end_) {
+      return false;
+    }
+
+    std::get<term_attribute>(attrs_).value = *begin_++;
+    return true;
+  }
+
+  void reset(const bytes_ref* begin, const bytes_ref* end) noexcept {
+    begin_ = begin;
+    end_ = end;
+  }
+
+ private:
+  std::tuple<term_attribute, increment> attrs_;
+  const bytes_ref* begin_{};
+  const bytes_ref* end_{};
+}; // terms_token_stream
+
+template<typename Column>
+bool has_unique_names(const std::vector<Column>& columns) noexcept {
+  for (auto begin = columns.begin(), end = columns.end(); begin != end; ++begin) {
+    for (auto it = std::next(begin); it != end; ++it) {
+      if (begin->name == it->name) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 }
 
 namespace iresearch {
 
+bool columnar_batch::valid() const noexcept {
+  for (auto& column : indexed) {
+    if (column.name.null()) {
+      return false;
+    }
+
+    if (column.analyzer) {
+      if (column.values.size() != docs) {
+        return false;
+      }
+    } else if (column.offsets.size() != docs + 1
+               || column.offsets[docs] > column.terms.size()
+               || !std::is_sorted(column.offsets.begin(), column.offsets.end())) {
+      return false;
+    }
+  }
+
+  for (auto& column : stored) {
+    if (column.name.null() || column.values.size() != docs) {
+      return false;
+    }
+  }
+
+  return (sorted.empty() || sorted.size() == docs)
+    && has_unique_names(indexed)
+    && has_unique_names(stored);
+}
+
+columnar_batch columnar_batch::slice(size_t offset, size_t count) const {
+  assert(offset + count <= docs);
+
+  columnar_batch batch;
+  batch.docs = count;
+  batch.indexed = indexed;
+  batch.stored = stored;
+
+  for (auto& column : batch.indexed) {
+    if (column.analyzer) {
+      column.values = { column.values.begin() + offset, count };
+    } else {
+      column.offsets = { column.offsets.begin() + offset, count + 1 };
+    }
+  }
+
+  for (auto& column : batch.stored) {
+    column.values = { column.values.begin() + offset, count };
+  }
+
+  if (!sorted.empty()) {
+    batch.sorted = { sorted.begin() + offset, count };
+  }
+
+  return batch;
+}
+
 segment_writer::stored_column::stored_column(
     const hashed_string_ref& name,
     columnstore_writer& columnstore,
@@ -97,6 +195,143 @@ doc_id_t segment_writer::begin(
   return doc_id_t(docs_cached() + doc_limits::min() - 1); // -1 for 0-based offset
 }
 
+doc_id_t segment_writer::begin(
+    const update_context& ctx,
+    size_t count,
+    size_t reserve_rollback_extra) {
+  if (doc_limits::eof() - doc_limits::min() < docs_cached() + count) {
+    return doc_limits::eof(); // the segment cannot fit that many documents
+  }
+
+  valid_ = true;
+  doc_.clear(); // clear norm fields
+
+  if (docs_mask_.capacity() <= docs_mask_.size() + count + reserve_rollback_extra) {
+    docs_mask_.reserve(
+      math::roundup_power2(docs_mask_.size() + count + reserve_rollback_extra) // reserve in blocks of power-of-2
+    ); // reserve space for potential rollback
+  }
+
+  const auto doc = doc_id_t(docs_cached() + doc_limits::min());
+  docs_context_.reserve(math::roundup_power2(docs_context_.size() + count)); // reserve in blocks of power-of-2
+  docs_context_.insert(docs_context_.end(), count, ctx);
+
+  return doc;
+}
+
+bool segment_writer::insert(const columnar_batch& batch, doc_id_t doc) {
+  REGISTER_TIMER_DETAILED();
+  assert(col_writer_);
+  assert(batch.valid());
+  assert(doc_limits::valid(doc));
+  assert(doc + batch.docs <= docs_cached() + doc_limits::min());
+
+  const doc_id_t end = doc_id_t(doc + batch.docs);
+  bool all_valid = true;
+
+  auto removed = [this](doc_id_t id) noexcept {
+    return docs_mask_.test(id - doc_limits::min());
+  };
+
+  auto remove_all = [&]() {
+    for (auto i = doc; i < end; ++i) {
+      remove(i);
+    }
+    all_valid = false;
+  };
+
+  terms_token_stream terms;
+
+  for (auto& column : batch.indexed) {
+    const auto name = make_hashed_ref(column.name);
+
+    // resolve a field once per batch rather than once per value
+    auto* slot = fields_.emplace(name, column.index_features, column.features, *col_writer_);
+    assert(::is_subset_of(column.features, slot->meta().features));
+
+    if (!is_subset_of(column.index_features, slot->meta().index_features)) {
+      remove_all();
+      break;
+    }
+
+    const bool shingles = 0 != slot->meta().features.count(
+      irs::type<phrase_shingles>::id());
+    token_stream& tokens = column.analyzer
+      ? static_cast<token_stream&>(*column.analyzer)
+      : static_cast<token_stream&>(terms);
+
+    for (auto i = doc; i < end; ++i) {
+      const size_t offset = i - doc;
+
+      if (removed(i)) {
+        continue;
+      }
+
+      if (column.analyzer) {
+        const auto& value = column.values[offset];
+
+        if (value.null()) {
+          continue;
+        }
+
+        if (!column.analyzer->reset(value)) {
+          remove(i);
+          all_valid = false;
+          continue;
+        }
+      } else {
+        const auto* terms_begin = column.terms.begin() + column.offsets[offset];
+        const auto* terms_end = column.terms.begin() + column.offsets[offset + 1];
+
+        if (terms_begin >= terms_end) {
+          continue;
+        }
+
+        terms.reset(terms_begin, terms_end);
+      }
+
+      if (shingles ? invert_shingles(*slot, name, i, tokens)
+                   : slot->invert(tokens, i)) {
+        // every document gets a single value of a field within a batch
+        slot->compute_features();
+      } else {
+        remove(i);
+        all_valid = false;
+      }
+    }
+  }
+
+  if (!batch.sorted.empty()) {
+    if (IRS_UNLIKELY(!fields_.comparator())) {
+      // can't store sorted field without a comparator
+      remove_all();
+    } else {
+      for (auto i = doc; i < end; ++i) {
+        const auto& value = batch.sorted[i - doc];
+
+        if (!value.null() && !removed(i)) {
+          sorted_stream(i).write_bytes(value.c_str(), value.size());
+        }
+      }
+    }
+  }
+
+  for (auto& stored : batch.stored) {
+    // resolve a column once per batch and fill it block-wise
+    auto& writer = column(make_hashed_ref(stored.name)).writer;
+
+    for (auto i = doc; i < end; ++i) {
+      const auto& value = stored.values[i - doc];
+
+      if (!value.null() && !removed(i)) {
+        writer(i).write_bytes(value.c_str(), value.size());
+      }
+    }
+  }
+
+  return all_valid;
+}
+
 segment_writer::ptr segment_writer::make(
     directory& dir,
     const field_features_t& field_features,
@@ -180,10 +415,16 @@ bool segment_writer::index(
 
   auto* slot = fields_.emplace(name, index_features, features, *col_writer_);
 
+  // every instance of a field gets shingles once any of them requested it,
+  // otherwise phrases couldn't be evaluated via a companion field
+  const bool shingles = 0 != slot->meta().features.count(
+    irs::type<phrase_shingles>::id());
+
   // invert only if new field index features are a subset of slot index features
   assert(::is_subset_of(features, slot->meta().features));
   if (is_subset_of(index_features, slot->meta().index_features) &&
-      slot->invert(tokens, doc)) {
+      (shingles ? invert_shingles(*slot, name, doc, tokens)
+                : slot->invert(tokens, doc))) {
     if (!slot->seen() && slot->has_features()) {
       doc_.emplace_back(slot);
       slot->seen(true);
@@ -196,18 +437,47 @@ bool segment_writer::index(
   return false;
 }
 
-column_output& segment_writer::stream(
+bool segment_writer::invert_shingles(
+    field_data& slot,
     const hashed_string_ref& name,
-    const doc_id_t doc_id) {
+    const doc_id_t doc,
+    token_stream& tokens) {
+  auto& shingles = shingles_[&slot];
+
+  if (shingles.doc != doc) {
+    // positions of a field start over with every document only
+    shingles.stream.reset();
+    shingles.doc = doc;
+  }
+
+  shingle_token_stream::recorder recorder(tokens, shingles.stream);
+
+  if (!slot.invert(recorder, doc)) {
+    return false;
+  }
+
+  const auto shingle_name = shingle_field(name);
+
+  // positions are required to evaluate phrases longer than 2 terms
+  auto* shingle_slot = fields_.emplace(
+    make_hashed_ref(string_ref(shingle_name)),
+    IndexFeatures::FREQ | IndexFeatures::POS,
+    features_t{}, *col_writer_);
+
+  return shingle_slot->invert(shingles.stream, doc);
+}
+
+const segment_writer::stored_column& segment_writer::column(
+    const hashed_string_ref& name) {
   REGISTER_TIMER_DETAILED();
   assert(column_info_);
 
-  return columns_.lazy_emplace(
+  return *columns_.lazy_emplace(
     name,
     [this, &name](const auto& ctor){
       ctor(name, *col_writer_, *column_info_,
            nullptr != fields_.comparator());
-  })->writer(doc_id);
+  });
 }
 
 void segment_writer::flush_column_meta(const segment_meta& meta) {
@@ -346,6 +616,7 @@ void segment_writer::reset() noexcept {
   docs_context_.clear();
   docs_mask_.clear();
   fields_.reset();
+  shingles_.clear();
   columns_.clear();
   sort_.stream.clear();
 
@@ -24,11 +24,14 @@
 #ifndef IRESEARCH_SEGMENT_WRITER_H
 #define IRESEARCH_SEGMENT_WRITER_H
 
+#include <absl/container/node_hash_map.h>
 #include <absl/container/node_hash_set.h>
 
 #include "column_info.hpp"
 #include "field_data.hpp"
 #include "sorted_column.hpp"
+#include "analysis/analyzer.hpp"
+#include "analysis/shingle_token_stream.hpp"
 #include "analysis/token_stream.hpp"
 #include "formats/formats.hpp"
 #include "utils/bitvector.hpp"
@@ -68,6 +71,59 @@ enum class Action {
 
 ENABLE_BITMASK_ENUM(Action);
 
+////////////////////////////////////////////////////////////////////////////////
+/// @struct columnar_batch
+/// @brief column-oriented representation of a batch of documents, values of
+///        every column are referenced rather than copied, i.e. the memory
+///        they point to must remain valid until the batch is inserted
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API columnar_batch {
+  //////////////////////////////////////////////////////////////////////////////
+  /// @struct indexed_column
+  /// @brief values of a field to be indexed, either analyzed by 'analyzer' or
+  ///        pre-tokenized, in the latter case terms of a document 'i' are
+  ///        [terms[offsets[i]], terms[offsets[i+1]])
+  /// @note documents having a NIL value or no terms are not indexed
+  //////////////////////////////////////////////////////////////////////////////
+  struct indexed_column {
+    string_ref name;
+    IndexFeatures index_features{IndexFeatures::NONE};
+    features_t features;
+    analysis::analyzer* analyzer{}; // reused for every value of a column
+    range<const string_ref> values; // 'docs' values, analyzed by 'analyzer'
+    range<const bytes_ref> terms; // pre-tokenized terms of all documents
+    range<const size_t> offsets; // 'docs + 1' offsets into 'terms'
+  }; // indexed_column
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @struct stored_column
+  /// @brief values of a column to be stored
+  /// @note NIL values are not stored
+  //////////////////////////////////////////////////////////////////////////////
+  struct stored_column {
+    string_ref name;
+    range<const bytes_ref> values; // 'docs' values
+  }; // stored_column
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return true if every column has a value per document, offsets of
+  ///         pre-tokenized terms are non-decreasing and names of indexed
+  ///         and stored columns are unique within a batch
+  //////////////////////////////////////////////////////////////////////////////
+  bool valid() const noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return a batch referencing documents [offset, offset + count) of this
+  ///         one, pre-tokenized terms are shared with this batch
+  //////////////////////////////////////////////////////////////////////////////
+  columnar_batch slice(size_t offset, size_t count) const;
+
+  size_t docs{};
+  std::vector<indexed_column> indexed;
+  std::vector<stored_column> stored;
+  range<const bytes_ref> sorted; // 'docs' values of a sorted column if any, NIL values are not stored
+}; // columnar_batch
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief interface for an index writer over a directory
 ///        an object that represents a single ongoing transaction
@@ -159,6 +215,20 @@ class IRESEARCH_API segment_writer : util::noncopyable {
   // @return doc_id_t as per type_limits<type_t::doc_id_t>
   doc_id_t begin(const update_context& ctx, size_t reserve_rollback_extra = 0);
 
+  // begin write transaction of 'count' documents sharing the same context
+  // @return doc_id_t of the first document or doc_limits::eof() if
+  //         a segment cannot fit that many documents
+  doc_id_t begin(
+    const update_context& ctx,
+    size_t count,
+    size_t reserve_rollback_extra);
+
+  // inverts and stores documents [doc, doc + batch.docs) as returned by
+  // begin(ctx, batch.docs, ...) column by column, documents failed to be
+  // inserted are marked as removed
+  // @return true if all documents were successfully inserted
+  bool insert(const columnar_batch& batch, doc_id_t doc);
+
   // @param doc_id the document id as returned by begin(...)
   // @return modifiable update_context for the specified doc_id
   update_context& doc_context(doc_id_t doc_id) {
@@ -420,10 +490,15 @@ class IRESEARCH_API segment_writer : util::noncopyable {
     return sort_.stream;
   }
 
+  // returns column for storing attributes
+  const stored_column& column(const hashed_string_ref& name);
+
   // returns stream for storing attributes
   column_output& stream(
     const hashed_string_ref& name,
-    const doc_id_t doc);
+    const doc_id_t doc) {
+    return column(name).writer(doc);
+  }
 
   // finishes document
   void finish() {
@@ -433,6 +508,19 @@ class IRESEARCH_API segment_writer : util::noncopyable {
     }
   }
 
+  // shingles of a field carried across its instances in a document
+  struct field_shingles {
+    shingle_token_stream stream;
+    doc_id_t doc{ doc_limits::invalid() };
+  };
+
+  // inverts a field along with its shingles companion field
+  bool invert_shingles(
+    field_data& slot,
+    const hashed_string_ref& name,
+    const doc_id_t doc,
+    token_stream& tokens);
+
   size_t flush_doc_mask(const segment_meta& meta); // flushes document mask to directory, returns number of masked documens
   void flush_column_meta(const segment_meta& meta); // flushes column meta to directory
   void flush_fields(const doc_map& docmap); // flushes indexed fields to directory
@@ -445,6 +533,7 @@ class IRESEARCH_API segment_writer : util::noncopyable {
   stored_columns columns_;
   std::vector<const stored_column*> sorted_columns_;
   std::vector<const field_data*> doc_; // document fields
+  absl::node_hash_map<const field_data*, field_shingles> shingles_; // shingles of a field in a document
   std::string seg_name_;
   field_writer::ptr field_writer_;
   const column_info_provider_t* column_info_;
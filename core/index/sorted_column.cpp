@@ -20,12 +20,69 @@
 /// @author Andrey Abramov
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <numeric>
+
 #include "shared.hpp"
 #include "sorted_column.hpp"
 #include "comparer.hpp"
 #include "utils/type_limits.hpp"
 #include "utils/misc.hpp"
 #include "utils/lz4compression.hpp"
+#include "utils/radix_sort.hpp"
+
+namespace {
+
+using namespace irs;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sort a specified range of documents by normalized keys of
+///        their values
+/// @returns false if documents are already sorted
+////////////////////////////////////////////////////////////////////////////////
+template<typename Iterator, typename GetValue>
+bool sort_normalized(
+    Iterator begin, Iterator end,
+    const comparer& less,
+    const GetValue& get_value) {
+  const size_t size = std::distance(begin, end);
+
+  // normalized keys of all documents are stored in a single buffer
+  bstring keys;
+  std::vector<size_t> offsets;
+  offsets.reserve(size + 1);
+
+  for (auto it = begin; it != end; ++it) {
+    offsets.push_back(keys.size());
+    less.normalize(get_value(it->first), keys);
+  }
+  offsets.push_back(keys.size());
+
+  auto key = [&keys, &offsets](size_t i) noexcept {
+    return bytes_ref(keys.c_str() + offsets[i], offsets[i + 1] - offsets[i]);
+  };
+
+  bool sorted = true;
+  for (size_t i = 1; i < size && sorted; ++i) {
+    sorted = !(key(i) < key(i - 1));
+  }
+
+  if (sorted) {
+    return false;
+  }
+
+  std::vector<size_t> order(size);
+  std::iota(order.begin(), order.end(), size_t(0));
+  msd_radix_sort(order, key);
+
+  std::vector<typename std::iterator_traits<Iterator>::value_type> values(begin, end);
+  for (size_t i = 0; i < size; ++i, ++begin) {
+    *begin = values[order[i]];
+  }
+
+  return true;
+}
+
+}
 
 namespace iresearch {
 
@@ -81,10 +138,20 @@ std::pair<doc_map, field_id> sorted_column::flush(
   doc_map docmap;
   auto begin = new_old.begin() + irs::doc_limits::min();
 
-  // perform extra check to avoid qsort worst case complexity
-  if (!std::is_sorted(begin, new_old.end(), comparer)) {
-    std::sort(begin, new_old.end(), comparer);
+  bool reordered;
+
+  if (less.has_normalizer()) {
+    reordered = sort_normalized(begin, new_old.end(), less, get_value);
+  } else {
+    // perform extra check to avoid qsort worst case complexity
+    reordered = !std::is_sorted(begin, new_old.end(), comparer);
+
+    if (reordered) {
+      std::sort(begin, new_old.end(), comparer);
+    }
+  }
 
+  if (reordered) {
     docmap.resize(new_old.size(), doc_limits::eof());
 
     for (size_t i = irs::doc_limits::min(), size = docmap.size(); i < size; ++i) {
@@ -22,6 +22,7 @@
 
 #include "all_filter.hpp"
 #include "all_iterator.hpp"
+#include "query_arena.hpp"
 
 namespace iresearch {
 
@@ -43,9 +44,9 @@ class all_query final : public filter::prepared {
   virtual doc_iterator::ptr execute(
       const sub_reader& rdr,
       const order::prepared& order,
-      const attribute_provider* /*ctx*/) const override {
-    return memory::make_managed<all_iterator>(
-      rdr, stats_.c_str(), order,
+      const attribute_provider* ctx) const override {
+    return query_arena::make_managed<all_iterator>(
+      ctx, rdr, stats_.c_str(), order,
       rdr.docs_count(), boost());
   }
 
@@ -63,7 +64,7 @@ filter::prepared::ptr all::prepare(
     const index_reader& reader,
     const order::prepared& order,
     boost_t filter_boost,
-    const attribute_provider* /*ctx*/) const {
+    const attribute_provider* ctx) const {
   // skip field-level/term-level statistics because there are no explicit
   // fields/terms, but still collect index-level statistics
   // i.e. all fields and terms implicitly match
@@ -72,7 +73,7 @@ filter::prepared::ptr all::prepare(
 
   order.prepare_collectors(stats_buf, reader);
 
-  return memory::make_managed<all_query>(std::move(stats), this->boost()*filter_boost);
+  return query_arena::make_managed<all_query>(ctx, std::move(stats), this->boost()*filter_boost);
 }
 
 } // ROOT
@@ -31,6 +31,8 @@
 #include "search/score.hpp"
 #include "utils/frozen_attributes.hpp"
 
+#include <numeric>
+
 namespace iresearch {
 
 class all_iterator final : public doc_iterator {
@@ -68,6 +70,31 @@ class all_iterator final : public doc_iterator {
     return doc.value;
   }
 
+  virtual size_t next_batch(
+      doc_id_t* docs,
+      uint32_t* /*freqs*/,
+      size_t size) noexcept override {
+    auto& doc = std::get<document>(attrs_);
+
+    // documents are consecutive
+    const size_t count = doc.value < max_doc_
+      ? std::min(size, size_t(max_doc_ - doc.value))
+      : 0;
+
+    std::iota(docs, docs + count, doc.value + 1);
+    doc.value += doc_id_t(count);
+
+    if (count < size) {
+      doc.value = doc_limits::eof();
+    }
+
+    return count;
+  }
+
+  virtual bool has_native_batch() const noexcept override {
+    return true;
+  }
+
   virtual irs::doc_id_t value() const noexcept override {
     return std::get<document>(attrs_).value;
   }
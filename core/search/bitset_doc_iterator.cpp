@@ -76,6 +76,29 @@ bool bitset_doc_iterator::next() noexcept {
   return true;
 }
 
+size_t bitset_doc_iterator::next_batch(
+    doc_id_t* docs,
+    uint32_t* /*freqs*/,
+    size_t size) noexcept {
+  size_t count = 0;
+
+  while (count < size && bitset_doc_iterator::next()) {
+    docs[count++] = doc_.value;
+
+    // drain the rest of the current word without refetching
+    while (word_ && count < size) {
+      const doc_id_t delta = doc_id_t(math::math_traits<word_t>::ctz(word_));
+      assert(delta < bits_required<word_t>());
+
+      word_ = (word_ >> delta) >> 1;
+      doc_.value += 1 + delta;
+      docs[count++] = doc_.value;
+    }
+  }
+
+  return count;
+}
+
 doc_id_t bitset_doc_iterator::seek(doc_id_t target) noexcept {
   const doc_id_t word_idx = target / bits_required<word_t>();
 
@@ -41,6 +41,8 @@ class bitset_doc_iterator
 
   virtual bool next() noexcept override final;
   virtual doc_id_t seek(doc_id_t target) noexcept override final;
+  virtual size_t next_batch(doc_id_t* docs, uint32_t* freqs, size_t size) noexcept override final;
+  virtual bool has_native_batch() const noexcept override final { return true; }
   virtual doc_id_t value() const noexcept override final { return doc_.value; }
   virtual attribute* get_mutable(irs::type_info::type_id id) noexcept override;
 
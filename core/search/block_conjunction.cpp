@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "block_conjunction.hpp"
+
+#include "utils/simd_utils.hpp"
+
+namespace {
+
+using namespace irs;
+
+// returns first position in [begin;end) which value is not less than
+// 'target', probes exponentially growing steps before binary search
+const doc_id_t* gallop(
+    const doc_id_t* begin,
+    const doc_id_t* end,
+    doc_id_t target) noexcept {
+  size_t step = 1;
+
+  for (; begin + step < end && begin[step] < target; step <<= 1) {
+    begin += step;
+  }
+
+  return std::lower_bound(begin, std::min(begin + step + 1, end), target);
+}
+
+}
+
+namespace iresearch {
+
+block_conjunction::sub_iterator::sub_iterator(doc_iterator::ptr&& it) noexcept
+  : it(std::move(it)),
+    doc(irs::get<document>(*this->it)) {
+  assert(doc);
+}
+
+block_conjunction::block_conjunction(doc_iterators_t&& itrs) {
+  assert(itrs.size() > 1);
+
+  // sort subnodes in ascending order by their cost
+  std::sort(itrs.begin(), itrs.end(),
+    [](const doc_iterator::ptr& lhs, const doc_iterator::ptr& rhs) {
+      return cost::extract(*lhs, cost::MAX) < cost::extract(*rhs, cost::MAX);
+  });
+
+  lead_ = std::move(itrs.front());
+  lead_doc_ = irs::get<document>(*lead_);
+  assert(lead_doc_);
+
+  const auto lead_cost = cost::extract(*lead_, cost::MAX);
+  std::get<cost>(attrs_).reset(lead_cost);
+
+  itrs_.reserve(itrs.size() - 1);
+  for (auto it = itrs.begin() + 1, end = itrs.end(); it != end; ++it) {
+    const auto cost = cost::extract(**it, cost::MAX);
+    auto& sub = itrs_.emplace_back(std::move(*it));
+    sub.gallop = cost / std::max(cost::cost_t(1), lead_cost) >= GALLOP_RATIO;
+  }
+}
+
+bool block_conjunction::next() {
+  auto& doc = std::get<document>(attrs_);
+
+  if (pos_ == size_ && !refill(false)) {
+    doc.value = doc_limits::eof();
+    return false;
+  }
+
+  doc.value = docs_[pos_++];
+  return true;
+}
+
+doc_id_t block_conjunction::seek(doc_id_t target) {
+  auto& doc = std::get<document>(attrs_);
+
+  if (target <= doc.value) {
+    return doc.value;
+  }
+
+  // candidates are sorted
+  pos_ = std::lower_bound(docs_ + pos_, docs_ + size_, target) - docs_;
+
+  if (pos_ == size_) {
+    bool include_current = false;
+
+    if (lead_doc_->value < target) {
+      if (doc_limits::eof(lead_->seek(target))) {
+        pos_ = size_ = 0;
+        return doc.value = doc_limits::eof();
+      }
+
+      include_current = true;
+    }
+
+    if (!refill(include_current)) {
+      return doc.value = doc_limits::eof();
+    }
+  }
+
+  return doc.value = docs_[pos_++];
+}
+
+bool block_conjunction::refill(bool include_current) {
+  pos_ = size_ = 0;
+
+  do {
+    size_t size = 0;
+
+    if (include_current) {
+      docs_[size++] = lead_doc_->value;
+      include_current = false;
+    }
+
+    size += lead_->next_batch(docs_ + size, nullptr, BLOCK_SIZE - size);
+
+    for (auto& sub : itrs_) {
+      if (!size) {
+        break;
+      }
+
+      size = sub.gallop
+        ? intersect_gallop(sub, size)
+        : intersect_block(sub, size);
+
+      if (sub.exhausted() && !size) {
+        return false;
+      }
+    }
+
+    if (size) {
+      size_ = size;
+      return true;
+    }
+  } while (!doc_limits::eof(lead_doc_->value));
+
+  return false;
+}
+
+size_t block_conjunction::intersect_block(sub_iterator& sub, size_t size) {
+  size_t matched = 0;
+
+  for (size_t i = 0; i < size; ) {
+    if (sub.begin == sub.end) {
+      if (doc_limits::eof(sub.doc->value)) {
+        break;
+      }
+
+      // everything buffered so far precedes the candidate,
+      // skip directly to it and read the following block
+      assert(sub.doc->value < docs_[i]);
+      const doc_id_t doc = sub.it->seek(docs_[i]);
+
+      if (doc_limits::eof(doc)) {
+        break;
+      }
+
+      sub.docs[0] = doc;
+      sub.begin = 0;
+      sub.end = 1 + sub.it->next_batch(sub.docs + 1, nullptr, BLOCK_SIZE - 1);
+    }
+
+    // candidates covered by the buffered block
+    const doc_id_t* sub_begin = sub.docs + sub.begin;
+    const doc_id_t* sub_end = sub.docs + sub.end;
+    const size_t end = std::upper_bound(docs_ + i, docs_ + size, sub_end[-1]) - docs_;
+
+    if (end == size) {
+      // keep buffered documents following the last candidate for the next block
+      sub.begin = std::upper_bound(sub_begin, sub_end, docs_[size - 1]) - sub.docs;
+    } else {
+      sub.begin = sub.end;
+    }
+
+    matched += simd::intersect(
+      docs_ + i, end - i,
+      sub_begin, size_t(sub_end - sub_begin),
+      docs_ + matched);
+
+    i = end;
+  }
+
+  return matched;
+}
+
+size_t block_conjunction::intersect_gallop(sub_iterator& sub, size_t size) {
+  size_t matched = 0;
+
+  for (size_t i = 0; i < size; ) {
+    const doc_id_t candidate = docs_[i];
+    doc_id_t doc = sub.doc->value;
+
+    if (doc < candidate) {
+      doc = sub.it->seek(candidate);
+    }
+
+    if (doc == candidate) {
+      docs_[matched++] = candidate;
+      ++i;
+    } else if (doc_limits::eof(doc)) {
+      break;
+    } else {
+      i = gallop(docs_ + i + 1, docs_ + size, doc) - docs_;
+    }
+  }
+
+  return matched;
+}
+
+} // ROOT
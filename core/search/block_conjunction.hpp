@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_BLOCK_CONJUNCTION_H
+#define IRESEARCH_BLOCK_CONJUNCTION_H
+
+#include "analysis/token_attributes.hpp"
+#include "search/cost.hpp"
+#include "search/score.hpp"
+#include "utils/frozen_attributes.hpp"
+
+namespace iresearch {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class block_conjunction
+/// @brief unscored conjunction intersecting blocks of documents instead of
+///        converging sub-iterators one candidate at a time
+///
+/// The least costly iterator (lead) produces a block of candidates via
+/// `doc_iterator::next_batch(...)`, the block is then narrowed down by every
+/// other iterator in ascending order of cost:
+///   - iterators of comparable cost are read in blocks as well, the blocks
+///     are intersected with the vectorized kernel
+///   - much more costly iterators are probed via `seek(...)` per candidate
+///     while the candidates rejected by a probe are skipped by galloping
+///
+/// @note sub-iterators aren't positioned at the current document, hence
+///       the iterator is suitable for unscored queries only
+////////////////////////////////////////////////////////////////////////////////
+class block_conjunction final : public doc_iterator {
+ public:
+  using doc_iterators_t = std::vector<doc_iterator::ptr>;
+
+  static constexpr size_t BLOCK_SIZE = 128;
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// @brief iterators which are at least GALLOP_RATIO times more costly than
+  ///        the lead are probed per candidate
+  ////////////////////////////////////////////////////////////////////////////
+  static constexpr cost::cost_t GALLOP_RATIO = 32;
+
+  explicit block_conjunction(doc_iterators_t&& itrs);
+
+  virtual attribute* get_mutable(irs::type_info::type_id type) noexcept override {
+    return irs::get_mutable(attrs_, type);
+  }
+
+  virtual doc_id_t value() const noexcept override {
+    return std::get<document>(attrs_).value;
+  }
+
+  virtual bool next() override;
+
+  virtual doc_id_t seek(doc_id_t target) override;
+
+ private:
+  using attributes = std::tuple<document, cost, score>;
+
+  struct sub_iterator {
+    explicit sub_iterator(doc_iterator::ptr&& it) noexcept;
+
+    // no buffered documents left and nothing to read
+    bool exhausted() const noexcept {
+      return begin == end && doc_limits::eof(doc->value);
+    }
+
+    doc_iterator::ptr it;
+    const document* doc;
+    bool gallop{false}; // probe candidates via seek
+    size_t begin{0}; // first unconsumed document in 'docs'
+    size_t end{0}; // end of buffered documents in 'docs'
+    doc_id_t docs[BLOCK_SIZE];
+  }; // sub_iterator
+
+  // reads next block of candidates matching all sub-iterators
+  bool refill(bool include_current);
+
+  // narrows down [docs_;docs_+size) to documents of 'sub'
+  size_t intersect_block(sub_iterator& sub, size_t size);
+  size_t intersect_gallop(sub_iterator& sub, size_t size);
+
+  attributes attrs_;
+  doc_iterator::ptr lead_;
+  const document* lead_doc_;
+  std::vector<sub_iterator> itrs_; // other iterators sorted by cost
+  size_t pos_{0}; // next candidate in 'docs_'
+  size_t size_{0}; // number of candidates in 'docs_'
+  doc_id_t docs_[BLOCK_SIZE]; // matched candidates
+}; // block_conjunction
+
+} // ROOT
+
+#endif // IRESEARCH_BLOCK_CONJUNCTION_H
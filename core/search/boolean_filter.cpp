@@ -22,12 +22,18 @@
 
 #include "boolean_filter.hpp"
 
+#include <algorithm>
+
 #include <boost/functional/hash.hpp>
 
+#include "block_conjunction.hpp"
 #include "conjunction.hpp"
 #include "disjunction.hpp"
 #include "min_match_disjunction.hpp"
 #include "exclusion.hpp"
+#include "query_arena.hpp"
+#include "query_planner.hpp"
+#include "query_profile.hpp"
 
 namespace {
 
@@ -45,14 +51,48 @@ std::pair<const irs::filter*, bool> optimize_not(const irs::Not& node) {
 }
 
 const irs::all all_docs_zero_boost = []() {irs::all a; a.boost(0); return a;}();
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class bounded_context
+/// @brief exposes a 'plan_bound' of a node to the nested ones, other
+///        attributes are requested from a parent context
+//////////////////////////////////////////////////////////////////////////////
+class bounded_context final : public irs::attribute_provider {
+ public:
+  explicit bounded_context(
+      const irs::attribute_provider* parent,
+      irs::cost::cost_t lead_cost = 0) noexcept
+    : parent_(parent) {
+    bound.lead_cost = lead_cost;
+  }
+
+  virtual irs::attribute* get_mutable(
+      irs::type_info::type_id type) noexcept override {
+    if (irs::type<irs::plan_bound>::id() == type) {
+      return &bound;
+    }
+
+    return parent_
+      ? const_cast<irs::attribute_provider*>(parent_)->get_mutable(type)
+      : nullptr;
+  }
+
+  irs::plan_bound bound;
+
+ private:
+  const irs::attribute_provider* parent_;
+}; // bounded_context
+
 //////////////////////////////////////////////////////////////////////////////
 /// @returns disjunction iterator created from the specified queries
+/// @param plan[out] strategy chosen for a segment
 //////////////////////////////////////////////////////////////////////////////
 template<typename QueryIterator, typename... Args>
 irs::doc_iterator::ptr make_disjunction(
     const irs::sub_reader& rdr,
     const irs::order::prepared& ord,
     const irs::attribute_provider* ctx,
+    irs::PlanType& plan,
     QueryIterator begin,
     QueryIterator end,
     Args&&... args) {
@@ -65,6 +105,7 @@ irs::doc_iterator::ptr make_disjunction(
   // check the size before the execution
   if (0 == size) {
     // empty or unreachable search criteria
+    plan = irs::PlanType::EMPTY;
     return irs::doc_iterator::empty();
   }
 
@@ -81,7 +122,20 @@ irs::doc_iterator::ptr make_disjunction(
     }
   }
 
+  switch (itrs.size()) {
+    case 0: plan = irs::PlanType::EMPTY; break;
+    case 1: plan = irs::PlanType::SINGLE; break;
+    default: plan = irs::PlanType::MERGE; break;
+  }
+
   if (ord.empty()) {
+    // dense clauses are cheaper to materialize than to merge,
+    // only possible without scoring
+    if (irs::query_planner::materialize_disjunction(rdr, itrs, ctx)) {
+      plan = irs::PlanType::BITSET;
+      return irs::query_planner::materialize(rdr, itrs, ctx);
+    }
+
     return irs::make_disjunction<disjunction_t>(
       std::move(itrs), ord, std::forward<Args>(args)...);
   }
@@ -92,12 +146,14 @@ irs::doc_iterator::ptr make_disjunction(
 
 //////////////////////////////////////////////////////////////////////////////
 /// @returns conjunction iterator created from the specified queries
+/// @param plan[out] strategy chosen for a segment
 //////////////////////////////////////////////////////////////////////////////
 template<typename QueryIterator, typename... Args>
 irs::doc_iterator::ptr make_conjunction(
     const irs::sub_reader& rdr,
     const irs::order::prepared& ord,
     const irs::attribute_provider* ctx,
+    irs::PlanType& plan,
     QueryIterator begin,
     QueryIterator end,
     Args&&... args) {
@@ -109,25 +165,97 @@ irs::doc_iterator::ptr make_conjunction(
   // check size before the execution
   switch (size) {
     case 0:
+      plan = irs::PlanType::EMPTY;
       return irs::doc_iterator::empty();
     case 1:
+      plan = irs::PlanType::SINGLE;
       return begin->execute(rdr, ord, ctx);
   }
 
+  // an empty clause makes the whole conjunction empty
+  plan = irs::PlanType::EMPTY;
+
   conjunction_t::doc_iterators_t itrs;
   itrs.reserve(size);
 
+  // nested disjunctions don't know the lead cost of the conjunction
+  // until all of its clauses are executed
+  struct deferred_clause {
+    size_t idx;
+    QueryIterator query;
+    irs::cost::cost_t cost; // min cost of the deferred disjunctions
+  };
+
+  bounded_context bounded_ctx(ctx);
+  std::vector<deferred_clause> deferred;
+
   for (;begin != end; ++begin) {
-    auto docs = begin->execute(rdr, ord, ctx);
+    bounded_ctx.bound.deferred = false;
+    auto docs = begin->execute(rdr, ord, &bounded_ctx);
 
     // filter out empty iterators
     if (irs::doc_limits::eof(docs->value())) {
       return irs::doc_iterator::empty();
     }
 
+    if (bounded_ctx.bound.deferred) {
+      deferred.push_back({ itrs.size(), begin, bounded_ctx.bound.deferred_cost });
+    }
+
     itrs.emplace_back(std::move(docs));
   }
 
+  if (!deferred.empty()) {
+    std::vector<irs::cost::cost_t> costs;
+    costs.reserve(itrs.size());
+    for (auto& it : itrs) {
+      costs.emplace_back(irs::cost::extract(it));
+    }
+
+    // execute clauses once again if their nested disjunctions are
+    // cheap enough to be materialized given the rest of the clauses
+    for (auto& clause : deferred) {
+      irs::cost::cost_t lead_cost = irs::cost::MAX;
+      for (size_t i = 0; i < costs.size(); ++i) {
+        if (i != clause.idx) {
+          lead_cost = std::min(lead_cost, costs[i]);
+        }
+      }
+      lead_cost = std::max(lead_cost, irs::cost::cost_t(1));
+
+      // an enclosing node may bound the clause as well
+      if (irs::query_planner::within_bound(lead_cost, clause.cost)
+          && irs::query_planner::within_bound(ctx, clause.cost)) {
+        bounded_ctx.bound = irs::plan_bound{};
+        bounded_ctx.bound.lead_cost = lead_cost;
+        itrs[clause.idx] = clause.query->execute(rdr, ord, &bounded_ctx);
+      }
+    }
+  }
+
+  bool native_batch = true;
+  for (auto& it : itrs) {
+    native_batch &= it->has_native_batch();
+  }
+
+  if (ord.empty() && native_batch) {
+    // no need to position every sub-iterator at a match
+    // without scoring, intersect blocks of documents instead,
+    // generic iterators, e.g. disjunctions or phrases, are
+    // cheaper to leapfrog than to read via the batch adapter
+    irs::block_conjunction::doc_iterators_t block_itrs;
+    block_itrs.reserve(size);
+
+    for (auto& it : itrs) {
+      block_itrs.emplace_back(std::move(it.it));
+    }
+
+    plan = irs::PlanType::LEAPFROG;
+    return irs::query_arena::make_managed<irs::block_conjunction>(
+      ctx, std::move(block_itrs));
+  }
+
+  plan = irs::PlanType::LEAPFROG;
   return irs::make_conjunction<conjunction_t>(
      std::move(itrs), ord, std::forward<Args>(args)...
   );
@@ -157,11 +285,21 @@ class boolean_query : public filter::prepared {
     }
 
     assert(excl_);
-    auto incl = execute(rdr, ord, ctx, begin(), begin() + excl_);
+    PlanType plan;
+    auto incl = execute(rdr, ord, ctx, plan, begin(), begin() + excl_);
+    query_planner::record(ctx, plan);
+
+    if (PlanType::EMPTY == plan) {
+      return incl;
+    }
 
-    // exclusion part does not affect scoring at all
-    auto excl = ::make_disjunction(rdr, order::prepared::unordered(), ctx,
-                                   begin() + excl_, end());
+    // exclusion part does not affect scoring at all, it's read
+    // up to the documents matched by the included part only
+    const bounded_context excl_ctx(
+      ctx, std::max(cost::extract(*incl), cost::cost_t(1)));
+    PlanType excl_plan;
+    auto excl = ::make_disjunction(rdr, order::prepared::unordered(), &excl_ctx,
+                                   excl_plan, begin() + excl_, end());
 
     // got empty iterator for excluded
     if (doc_limits::eof(excl->value())) {
@@ -169,7 +307,8 @@ class boolean_query : public filter::prepared {
       return incl;
     }
 
-    return memory::make_managed<exclusion>(std::move(incl), std::move(excl));
+    return query_arena::make_managed<exclusion>(
+      ctx, std::move(incl), std::move(excl));
   }
 
   virtual void prepare(
@@ -187,19 +326,20 @@ class boolean_query : public filter::prepared {
 
     // prepare included
     for (const auto* filter : incl) {
-      queries.emplace_back(filter->prepare(rdr, ord, boost, ctx));
+      queries.emplace_back(prepare_profiled(*filter, rdr, ord, boost, ctx));
     }
 
     // prepare excluded
     for (const auto* filter : excl) {
       // exclusion part does not affect scoring at all
-      queries.emplace_back(filter->prepare(
-        rdr, order::prepared::unordered(), irs::no_boost(), ctx));
+      queries.emplace_back(prepare_profiled(
+        *filter, rdr, order::prepared::unordered(), irs::no_boost(), ctx));
     }
 
     // nothrow block
     queries_ = std::move(queries);
     excl_ = incl.size();
+    all_last_ = !incl.empty() && irs::type<all>::id() == incl.back()->type();
   }
 
   iterator begin() const { return iterator(queries_.begin()); }
@@ -209,11 +349,21 @@ class boolean_query : public filter::prepared {
   bool empty() const { return queries_.empty(); }
   size_t size() const { return queries_.size(); }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if the last included query matches all documents, i.e.
+  ///          'all' left by 'And'/'Or' optimizations to hold boost
+  //////////////////////////////////////////////////////////////////////////////
+  bool all_last() const noexcept { return all_last_; }
+
  protected:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @param plan[out] strategy chosen for a specified segment
+  //////////////////////////////////////////////////////////////////////////////
   virtual doc_iterator::ptr execute(
     const sub_reader& rdr,
     const order::prepared& ord,
     const attribute_provider* ctx,
+    PlanType& plan,
     iterator begin,
     iterator end) const = 0;
 
@@ -223,6 +373,7 @@ class boolean_query : public filter::prepared {
   queries_t queries_;
   // index of the first excluded query
   size_t excl_;
+  bool all_last_{};
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -235,9 +386,15 @@ class and_query final : public boolean_query {
       const sub_reader& rdr,
       const order::prepared& ord,
       const attribute_provider* ctx,
+      PlanType& plan,
       iterator begin,
       iterator end) const override {
-    return ::make_conjunction(rdr, ord, ctx, begin, end);
+    if (ord.empty() && all_last() && std::distance(begin, end) > 1) {
+      // 'all' doesn't affect matches of a conjunction without scoring
+      --end;
+    }
+
+    return ::make_conjunction(rdr, ord, ctx, plan, begin, end);
   }
 };
 
@@ -251,9 +408,10 @@ class or_query final : public boolean_query {
       const sub_reader& rdr,
       const order::prepared& ord,
       const attribute_provider* ctx,
+      PlanType& plan,
       iterator begin,
       iterator end) const override {
-    return ::make_disjunction(rdr, ord, ctx, begin, end);
+    return ::make_disjunction(rdr, ord, ctx, plan, begin, end);
   }
 }; // or_query
 
@@ -277,6 +435,7 @@ class min_match_query final : public boolean_query {
       const sub_reader& rdr,
       const order::prepared& ord,
       const attribute_provider* ctx,
+      PlanType& plan,
       iterator begin,
       iterator end) const override {
     assert(std::distance(begin, end) >= 0);
@@ -288,10 +447,11 @@ class min_match_query final : public boolean_query {
     // check the size before the execution
     if (0 == size || min_match_count > size) {
       // empty or unreachable search criteria
+      plan = PlanType::EMPTY;
       return doc_iterator::empty();
     } else if (min_match_count == size) {
       // pure conjunction
-      return ::make_conjunction(rdr, ord, ctx, begin, end);
+      return ::make_conjunction(rdr, ord, ctx, plan, begin, end);
     }
 
     // min_match_count <= size
@@ -310,14 +470,25 @@ class min_match_query final : public boolean_query {
       }
     }
 
+    if (min_match_count > itrs.size()) {
+      plan = PlanType::EMPTY;
+    } else if (1 == itrs.size()) {
+      plan = PlanType::SINGLE;
+    } else if (min_match_count == itrs.size()) {
+      plan = PlanType::LEAPFROG;
+    } else {
+      plan = PlanType::MERGE;
+    }
+
     return make_min_match_disjunction(
-      std::move(itrs), ord, min_match_count);
+      std::move(itrs), ord, ctx, min_match_count);
   }
 
  private:
   static doc_iterator::ptr make_min_match_disjunction(
       disjunction_t::doc_iterators_t&& itrs,
       const order::prepared& ord,
+      const attribute_provider* ctx,
       size_t min_match_count) {
     const auto size = min_match_count > itrs.size() ? 0 : itrs.size();
 
@@ -334,7 +505,8 @@ class min_match_query final : public boolean_query {
       typedef conjunction<doc_iterator::ptr> conjunction_t;
 
       // pure conjunction
-      return memory::make_managed<conjunction_t>(
+      return query_arena::make_managed<conjunction_t>(
+        ctx,
         conjunction_t::doc_iterators_t(
           std::make_move_iterator(itrs.begin()),
           std::make_move_iterator(itrs.end())), ord);
@@ -344,10 +516,12 @@ class min_match_query final : public boolean_query {
     assert(min_match_count < size);
 
     if (ord.empty()) {
-      return memory::make_managed<disjunction_t>(std::move(itrs), min_match_count);
+      return query_arena::make_managed<disjunction_t>(
+        ctx, std::move(itrs), min_match_count);
     }
 
-    return memory::make_managed<scored_disjunction_t>(std::move(itrs), min_match_count, ord);
+    return query_arena::make_managed<scored_disjunction_t>(
+      ctx, std::move(itrs), min_match_count, ord);
   }
 
   size_t min_match_count_;
@@ -519,9 +693,9 @@ filter::prepared::ptr And::prepare(
   boost *= this->boost();
   if (1 == incl.size() && excl.empty()) {
     // single node case
-    return incl.front()->prepare(rdr, ord, boost, ctx);
+    return prepare_profiled(*incl.front(), rdr, ord, boost, ctx);
   }
-  auto q = memory::make_managed<and_query>();
+  auto q = query_arena::make_managed<and_query>(ctx);
   q->prepare(rdr, ord, boost, ctx, incl, excl);
   return q;
 }
@@ -611,18 +785,18 @@ filter::prepared::ptr Or::prepare(
 
   if (1 == incl.size() && excl.empty()) {
     // single node case
-    return incl.front()->prepare(rdr, ord, boost, ctx);
+    return prepare_profiled(*incl.front(), rdr, ord, boost, ctx);
   }
 
   assert(adjusted_min_match_count > 0 && adjusted_min_match_count <= incl.size());
 
   memory::managed_ptr<boolean_query> q;
   if (adjusted_min_match_count == incl.size()) {
-    q = memory::make_managed<and_query>();
+    q = query_arena::make_managed<and_query>(ctx);
   } else if (1 == adjusted_min_match_count) {
-    q = memory::make_managed<or_query>();
+    q = query_arena::make_managed<or_query>(ctx);
   } else { // min_match_count > 1 && min_match_count < incl.size()
-    q = memory::make_managed<min_match_query>(adjusted_min_match_count);
+    q = query_arena::make_managed<min_match_query>(ctx, adjusted_min_match_count);
   }
 
   q->prepare(rdr, ord, boost, ctx, incl, excl);
@@ -657,13 +831,13 @@ filter::prepared::ptr Not::prepare(
     const std::vector<const irs::filter*> incl { &all_docs };
     const std::vector<const irs::filter*> excl { res.first };
 
-    auto q = memory::make_managed<and_query>();
+    auto q = query_arena::make_managed<and_query>(ctx);
     q->prepare(rdr, ord, boost, ctx, incl, excl);
     return q;
   }
 
   // negation has been optimized out
-  return res.first->prepare(rdr, ord, boost, ctx);
+  return prepare_profiled(*res.first, rdr, ord, boost, ctx);
 }
 
 size_t Not::hash() const noexcept {
@@ -24,6 +24,7 @@
 
 #include "formats/empty_term_reader.hpp"
 #include "search/disjunction.hpp"
+#include "search/query_arena.hpp"
 
 namespace {
 
@@ -146,7 +147,7 @@ filter::prepared::ptr by_column_existence::prepare(
     const index_reader& reader,
     const order::prepared& order,
     boost_t filter_boost,
-    const attribute_provider* /*ctx*/) const {
+    const attribute_provider* ctx) const {
   // skip field-level/term-level statistics because there are no explicit
   // fields/terms, but still collect index-level statistics
   // i.e. all fields and terms implicitly match
@@ -158,8 +159,8 @@ filter::prepared::ptr by_column_existence::prepare(
   filter_boost *= boost();
 
   return options().prefix_match
-    ? memory::make_managed<column_prefix_existence_query>(field(), std::move(stats), filter_boost)
-    : memory::make_managed<column_existence_query>(field(), std::move(stats), filter_boost);
+    ? query_arena::make_managed<column_prefix_existence_query>(ctx, field(), std::move(stats), filter_boost)
+    : query_arena::make_managed<column_existence_query>(ctx, field(), std::move(stats), filter_boost);
 }
 
 } // ROOT
@@ -0,0 +1,272 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "column_filter.hpp"
+
+#include "analysis/token_attributes.hpp"
+#include "formats/empty_term_reader.hpp"
+#include "index/index_reader.hpp"
+#include "search/cost.hpp"
+#include "search/query_arena.hpp"
+#include "search/score.hpp"
+#include "utils/frozen_attributes.hpp"
+
+namespace {
+
+using namespace irs;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class column_filter_iterator
+/// @brief iterates over documents of a column having values accepted by
+///        the specified predicate
+////////////////////////////////////////////////////////////////////////////////
+template<typename Predicate>
+class column_filter_iterator final : public doc_iterator {
+ public:
+  column_filter_iterator(
+      const sub_reader& segment,
+      const columnstore_reader::column_reader& column,
+      doc_iterator::ptr&& it,
+      const Predicate& pred,
+      const byte_type* stats,
+      const order::prepared& ord,
+      boost_t boost)
+    : it_(std::move(it)),
+      doc_(irs::get<document>(*it_)),
+      payload_(irs::get<payload>(*it_)),
+      pred_(pred) {
+    assert(doc_);
+    std::get<attribute_ptr<document>>(attrs_) = const_cast<document*>(doc_);
+
+    // every value in a column has to be checked to enumerate all matches
+    std::get<cost>(attrs_).reset(column.size());
+
+    if (!ord.empty()) {
+      auto& score = std::get<irs::score>(attrs_);
+
+      score.realloc(ord);
+
+      order::prepared::scorers scorers(
+        ord, segment, empty_term_reader(column.size()),
+        stats, score.data(), *this, boost);
+
+      irs::reset(score, std::move(scorers));
+    }
+  }
+
+  virtual attribute* get_mutable(irs::type_info::type_id type) noexcept override {
+    return irs::get_mutable(attrs_, type);
+  }
+
+  virtual doc_id_t value() const noexcept override {
+    return doc_->value;
+  }
+
+  virtual bool next() override {
+    while (it_->next()) {
+      if (match()) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  virtual doc_id_t seek(doc_id_t target) override {
+    if (target <= doc_->value) {
+      return doc_->value;
+    }
+
+    // verify the candidate via random access first,
+    // fall back to a scan only in case of a mismatch
+    if (doc_limits::eof(it_->seek(target)) || match()) {
+      return doc_->value;
+    }
+
+    next();
+
+    return doc_->value;
+  }
+
+ private:
+  using attributes = std::tuple<attribute_ptr<document>, cost, score>;
+
+  bool match() const {
+    return pred_(payload_ ? payload_->value : bytes_ref::EMPTY);
+  }
+
+  doc_iterator::ptr it_;
+  const document* doc_;
+  const payload* payload_;
+  Predicate pred_;
+  attributes attrs_;
+}; // column_filter_iterator
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class column_filter_query
+////////////////////////////////////////////////////////////////////////////////
+template<typename Predicate>
+class column_filter_query final : public filter::prepared {
+ public:
+  column_filter_query(
+      const std::string& field,
+      Predicate&& pred,
+      bstring&& stats,
+      boost_t boost)
+    : filter::prepared(boost),
+      field_(field),
+      pred_(std::move(pred)),
+      stats_(std::move(stats)) {
+  }
+
+  virtual doc_iterator::ptr execute(
+      const sub_reader& segment,
+      const order::prepared& ord,
+      const attribute_provider* ctx) const override {
+    const auto* column = segment.column_reader(field_);
+
+    if (!column) {
+      return doc_iterator::empty();
+    }
+
+    auto it = column->iterator();
+
+    if (IRS_UNLIKELY(!it)) {
+      return doc_iterator::empty();
+    }
+
+    return query_arena::make_managed<column_filter_iterator<Predicate>>(
+      ctx, segment, *column, std::move(it), pred_, stats_.c_str(), ord, boost());
+  }
+
+ private:
+  std::string field_;
+  Predicate pred_;
+  bstring stats_;
+}; // column_filter_query
+
+struct term_predicate {
+  bool operator()(const bytes_ref& value) const noexcept {
+    return value == bytes_ref(term);
+  }
+
+  bstring term;
+}; // term_predicate
+
+struct range_predicate {
+  bool operator()(const bytes_ref& value) const noexcept {
+    switch (range.min_type) {
+      case BoundType::INCLUSIVE:
+        if (compare(value, range.min) < 0) {
+          return false;
+        }
+        break;
+      case BoundType::EXCLUSIVE:
+        if (compare(value, range.min) <= 0) {
+          return false;
+        }
+        break;
+      case BoundType::UNBOUNDED:
+        break;
+    }
+
+    switch (range.max_type) {
+      case BoundType::INCLUSIVE:
+        return compare(value, range.max) <= 0;
+      case BoundType::EXCLUSIVE:
+        return compare(value, range.max) < 0;
+      case BoundType::UNBOUNDED:
+        break;
+    }
+
+    return true;
+  }
+
+  by_column_range_options::range_type range;
+}; // range_predicate
+
+bool is_empty(const by_column_range_options::range_type& rng) noexcept {
+  if (BoundType::UNBOUNDED == rng.min_type || BoundType::UNBOUNDED == rng.max_type) {
+    return false;
+  }
+
+  const int cmp = compare(bytes_ref(rng.min), rng.max);
+
+  return cmp > 0 ||
+    (0 == cmp && (BoundType::EXCLUSIVE == rng.min_type ||
+                  BoundType::EXCLUSIVE == rng.max_type));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief collect index-level statistics only since there are
+///        no fields/terms involved
+////////////////////////////////////////////////////////////////////////////////
+bstring prepare_stats(const index_reader& reader, const order::prepared& ord) {
+  bstring stats(ord.stats_size(), 0);
+  auto* stats_buf = const_cast<byte_type*>(stats.data());
+
+  ord.prepare_collectors(stats_buf, reader);
+
+  return stats;
+}
+
+}
+
+namespace iresearch {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                     by_column_term implementation
+// -----------------------------------------------------------------------------
+
+DEFINE_FACTORY_DEFAULT(by_column_term)
+
+filter::prepared::ptr by_column_term::prepare(
+    const index_reader& reader,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const {
+  return query_arena::make_managed<column_filter_query<term_predicate>>(
+    ctx, field(), term_predicate{options().term},
+    prepare_stats(reader, ord), this->boost()*boost);
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                    by_column_range implementation
+// -----------------------------------------------------------------------------
+
+DEFINE_FACTORY_DEFAULT(by_column_range)
+
+filter::prepared::ptr by_column_range::prepare(
+    const index_reader& reader,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const {
+  const auto& rng = options().range;
+
+  if (is_empty(rng)) {
+    return prepared::empty();
+  }
+
+  return query_arena::make_managed<column_filter_query<range_predicate>>(
+    ctx, field(), range_predicate{rng},
+    prepare_stats(reader, ord), this->boost()*boost);
+}
+
+} // ROOT
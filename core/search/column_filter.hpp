@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_COLUMN_FILTER_H
+#define IRESEARCH_COLUMN_FILTER_H
+
+#include "search/filter.hpp"
+#include "search/search_range.hpp"
+#include "utils/string.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Column-backed filters evaluate a predicate against the values stored in a
+/// column instead of traversing the inverted index. Values are compared as
+/// raw byte strings, i.e. a stored encoding must be order preserving for
+/// range queries to make sense (e.g. big-endian integers).
+///
+/// Iterators produced by these filters report the number of documents
+/// having a value in a column as their cost since that is the amount of work
+/// required to enumerate all matches. Being the most expensive leg of a
+/// conjunction such iterators never drive it but only verify candidates
+/// produced by a cheaper leg via random access seeks, e.g. for
+/// "tenant AND time range" queries the range is never materialized.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace iresearch {
+
+class by_column_term;
+class by_column_range;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct by_column_term_options
+/// @brief options for column term filter
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API by_column_term_options {
+  using filter_type = by_column_term;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief stored value to match
+  //////////////////////////////////////////////////////////////////////////////
+  bstring term;
+
+  bool operator==(const by_column_term_options& rhs) const noexcept {
+    return term == rhs.term;
+  }
+
+  size_t hash() const noexcept {
+    return std::hash<bstring>()(term);
+  }
+}; // by_column_term_options
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class by_column_term
+/// @brief user-side filter matching documents with a stored value equal to
+///        the specified one
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API by_column_term final
+    : public filter_base<by_column_term_options> {
+ public:
+  DECLARE_FACTORY();
+
+  using filter::prepare;
+
+  virtual filter::prepared::ptr prepare(
+    const index_reader& rdr,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const override;
+}; // by_column_term
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct by_column_range_options
+/// @brief options for column range filter
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API by_column_range_options {
+  using filter_type = by_column_range;
+  using range_type = search_range<bstring>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief range of stored values to match
+  //////////////////////////////////////////////////////////////////////////////
+  range_type range;
+
+  bool operator==(const by_column_range_options& rhs) const noexcept {
+    return range == rhs.range;
+  }
+
+  size_t hash() const noexcept {
+    return std::hash<range_type>()(range);
+  }
+}; // by_column_range_options
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class by_column_range
+/// @brief user-side filter matching documents with a stored value within
+///        the specified range
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API by_column_range final
+    : public filter_base<by_column_range_options> {
+ public:
+  DECLARE_FACTORY();
+
+  using filter::prepare;
+
+  virtual filter::prepared::ptr prepare(
+    const index_reader& rdr,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const override;
+}; // by_column_range
+
+} // ROOT
+
+namespace std {
+
+template<>
+struct hash<::iresearch::by_column_term_options> {
+  size_t operator()(const ::iresearch::by_column_term_options& v) const noexcept {
+    return v.hash();
+  }
+};
+
+template<>
+struct hash<::iresearch::by_column_range_options> {
+  size_t operator()(const ::iresearch::by_column_range_options& v) const noexcept {
+    return v.hash();
+  }
+};
+
+}
+
+#endif // IRESEARCH_COLUMN_FILTER_H
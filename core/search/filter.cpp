@@ -21,6 +21,12 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "filter.hpp"
+
+#include <algorithm>
+
+#include "analysis/token_attributes.hpp"
+#include "index/index_reader.hpp"
+#include "search/query_arena.hpp"
 #include "utils/singleton.hpp"
 
 namespace {
@@ -41,6 +47,68 @@ struct empty_query final
   }
 }; // empty_query
 
+//////////////////////////////////////////////////////////////////////////////
+/// @class range_doc_iterator
+/// @brief restricts a wrapped iterator to documents within [min, max)
+/// @note 'document' attribute is owned by the iterator since its value
+///       has to be 'eof' once the wrapped iterator passes 'max', all other
+///       attributes, e.g. 'score', are served by the wrapped iterator
+//////////////////////////////////////////////////////////////////////////////
+class range_doc_iterator final : public irs::doc_iterator {
+ public:
+  range_doc_iterator(
+      irs::doc_iterator::ptr&& it,
+      irs::doc_id_t min,
+      irs::doc_id_t max) noexcept
+    : it_(std::move(it)), min_(min), max_(max) {
+    assert(it_);
+    assert(irs::doc_limits::valid(min_));
+  }
+
+  virtual irs::attribute* get_mutable(irs::type_info::type_id type) noexcept override {
+    return irs::type<irs::document>::id() == type
+      ? &doc_
+      : it_->get_mutable(type);
+  }
+
+  virtual irs::doc_id_t value() const noexcept override {
+    return doc_.value;
+  }
+
+  virtual bool next() override {
+    if (irs::doc_limits::eof(doc_.value)) {
+      return false;
+    }
+
+    if (!irs::doc_limits::valid(doc_.value)) {
+      // the very first call, skip directly to the beginning of a range
+      return !irs::doc_limits::eof(assign(it_->seek(min_)));
+    }
+
+    return !irs::doc_limits::eof(
+      assign(it_->next() ? it_->value() : irs::doc_limits::eof()));
+  }
+
+  virtual irs::doc_id_t seek(irs::doc_id_t target) override {
+    if (target <= doc_.value) {
+      return doc_.value;
+    }
+
+    return assign(it_->seek(std::max(target, min_)));
+  }
+
+ private:
+  irs::doc_id_t assign(irs::doc_id_t doc) noexcept {
+    doc_.value = doc < max_ ? doc : irs::doc_limits::eof();
+    return doc_.value;
+  }
+
+  irs::doc_iterator::ptr it_;
+  irs::document doc_;
+  irs::doc_id_t min_;
+  irs::doc_id_t max_;
+}; // range_doc_iterator
+
 } // LOCAL
 
 namespace iresearch {
@@ -57,6 +125,29 @@ filter::prepared::ptr filter::prepared::empty() {
   return memory::to_managed<filter::prepared, false>(&empty_query::instance());
 }
 
+doc_iterator::ptr filter::prepared::execute(
+    const sub_reader& rdr,
+    const order::prepared& ord,
+    doc_id_t min, doc_id_t max,
+    const attribute_provider* ctx /*= nullptr*/) const {
+  min = std::max(min, doc_limits::min());
+  max = static_cast<doc_id_t>(std::min<uint64_t>(
+    max, doc_limits::min() + rdr.docs_count()));
+
+  if (min >= max) {
+    return doc_iterator::empty();
+  }
+
+  auto it = execute(rdr, ord, ctx);
+
+  if (doc_limits::min() == min && doc_limits::min() + rdr.docs_count() == max) {
+    return it; // whole segment
+  }
+
+  return query_arena::make_managed<range_doc_iterator>(
+    ctx, std::move(it), min, max);
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                             empty
 // -----------------------------------------------------------------------------
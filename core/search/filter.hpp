@@ -73,6 +73,22 @@ class IRESEARCH_API filter {
       const order::prepared& ord,
       const attribute_provider* ctx) const = 0;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief execute a query over documents within [min, max) of a segment
+    /// @note the returned iterator reaches 'min' via 'seek(...)', i.e. skip
+    ///       lists are used instead of scanning from the beginning of a
+    ///       segment, and is exhausted as soon as 'max' is reached
+    /// @note intended for splitting a large segment among several workers
+    /// @note as with the other 'execute(...)' overloads removed documents are
+    ///       not filtered out, callers have to wrap the returned iterator
+    ///       via 'sub_reader::mask(...)'
+    ////////////////////////////////////////////////////////////////////////////
+    doc_iterator::ptr execute(
+      const sub_reader& rdr,
+      const order::prepared& ord,
+      doc_id_t min, doc_id_t max,
+      const attribute_provider* ctx = nullptr) const;
+
     boost_t boost() const noexcept { return boost_; }
 
    protected:
@@ -25,6 +25,8 @@
 #include "shared.hpp"
 #include "search/bitset_doc_iterator.hpp"
 #include "search/disjunction.hpp"
+#include "search/query_arena.hpp"
+#include "search/query_planner.hpp"
 #include "utils/bitset.hpp"
 #include "utils/range.hpp"
 
@@ -110,7 +112,7 @@ namespace iresearch {
 doc_iterator::ptr multiterm_query::execute(
     const sub_reader& segment,
     const order::prepared& ord,
-    const attribute_provider* /*ctx*/) const {
+    const attribute_provider* ctx) const {
   using scored_disjunction_t = scored_disjunction_iterator<doc_iterator::ptr>;
   using disjunction_t = disjunction_iterator<doc_iterator::ptr>;
 
@@ -119,6 +121,7 @@ doc_iterator::ptr multiterm_query::execute(
 
   if (!state) {
     // invalid state
+    query_planner::record(ctx, PlanType::EMPTY);
     return doc_iterator::empty();
   }
 
@@ -128,15 +131,27 @@ doc_iterator::ptr multiterm_query::execute(
   // get required features for order
   const IndexFeatures features = ord.features();
   auto& stats = this->stats();
+  const bool no_score = ord.empty();
 
+  // without scoring all terms are alike and matches are materialized
+  // if they are dense enough within a segment, unscored terms are unioned
+  // via 'bit_union' unless there are just a few sparse ones, then they are
+  // merged on the fly instead
+  const size_t terms_count =
+    state->scored_states.size() + state->unscored_terms.size();
+  const bool materialize = no_score && query_planner::materialize_disjunction(
+    segment, terms_count, state->estimation());
   const bool has_unscored_terms = !state->unscored_terms.empty();
+  const bool unscored_bitset = has_unscored_terms
+    && (!no_score || !query_planner::merge_terms(
+          segment, terms_count, state->estimation()));
 
   disjunction_t::doc_iterators_t itrs(
-    state->scored_states.size() + size_t(has_unscored_terms));
+    state->scored_states.size() +
+    (unscored_bitset ? 1 : state->unscored_terms.size()));
   auto it = itrs.begin();
 
   // add an iterator for each of the scored states
-  const bool no_score = ord.empty();
   for (auto& entry : state->scored_states) {
     assert(entry.cookie);
     auto docs = reader->postings(*entry.cookie, features);
@@ -164,20 +179,46 @@ doc_iterator::ptr multiterm_query::execute(
     ++it;
   }
 
-  if (has_unscored_terms) {
+  if (unscored_bitset) {
     *it = {
-      memory::make_managed<::lazy_bitset_iterator>(
-        segment, *state->reader, ord,
+      query_arena::make_managed<::lazy_bitset_iterator>(
+        ctx, segment, *state->reader, ord,
         state->unscored_terms,
         state->unscored_states_estimation)
     };
     ++it;
+  } else {
+    for (auto& cookie : state->unscored_terms) {
+      assert(cookie);
+      auto docs = reader->postings(*cookie, features);
+
+      if (IRS_UNLIKELY(!docs)) {
+        continue;
+      }
+
+      *it = std::move(docs);
+      ++it;
+    }
   }
 
   if (IRS_UNLIKELY(it != itrs.end())) {
     itrs.erase(it, itrs.end());
   }
 
+  if (materialize && itrs.size() > 1) {
+    query_planner::record(ctx, PlanType::BITSET);
+    return query_planner::materialize(segment, itrs, ctx);
+  }
+
+  if (itrs.empty()) {
+    query_planner::record(ctx, PlanType::EMPTY);
+  } else if (1 == itrs.size()) {
+    query_planner::record(
+      ctx, unscored_bitset ? PlanType::BITSET : PlanType::SINGLE);
+  } else {
+    query_planner::record(ctx, PlanType::MERGE);
+  }
+
   if (ord.empty()) {
     return make_disjunction<disjunction_t>(
       std::move(itrs), ord, merge_type_,
@@ -0,0 +1,386 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "parallel_executor.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+#include "analysis/token_attributes.hpp"
+#include "index/index_reader.hpp"
+#include "search/score.hpp"
+#include "utils/misc.hpp"
+
+namespace {
+
+using namespace irs;
+
+// number of documents visited between checks of a cancellation flag
+constexpr size_t CANCEL_CHECK_INTERVAL = 1024;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct partition
+/// @brief doc-id range [min, max) of a segment processed by a single worker
+////////////////////////////////////////////////////////////////////////////////
+struct partition {
+  size_t segment;
+  doc_id_t min;
+  doc_id_t max;
+}; // partition
+
+std::vector<partition> make_partitions(
+    const index_reader& reader,
+    doc_id_t range_size) {
+  // ranges are aligned to bitset words, i.e. workers
+  // filling the same bitset never touch the same word
+  constexpr doc_id_t WORD_BITS = bits_required<bitset::word_t>();
+  range_size = range_size
+    ? WORD_BITS*((range_size + WORD_BITS - 1)/WORD_BITS)
+    : doc_limits::eof();
+
+  std::vector<partition> partitions;
+  partitions.reserve(reader.size());
+
+  size_t i = 0;
+  for (auto& segment : reader) {
+    const doc_id_t end = doc_limits::min() + static_cast<doc_id_t>(segment.docs_count());
+
+    for (doc_id_t min = doc_limits::min(); min < end; ) {
+      const doc_id_t max = end - min > range_size
+        ? (min/range_size + 1)*range_size
+        : end;
+      partitions.push_back({ i, min, max });
+      min = max;
+    }
+
+    ++i;
+  }
+
+  return partitions;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class execution
+/// @brief state of a single query execution shared among workers
+////////////////////////////////////////////////////////////////////////////////
+class execution : util::noncopyable {
+ public:
+  execution(
+      const index_reader& reader,
+      const parallel_executor::options& opts)
+    : partitions_(make_partitions(reader, opts.range_size)),
+      cancel_(opts.cancel) {
+  }
+
+  const partition* next() noexcept {
+    if (cancelled()) {
+      return nullptr;
+    }
+
+    const size_t i = next_.fetch_add(1, std::memory_order_relaxed);
+    return i < partitions_.size() ? &partitions_[i] : nullptr;
+  }
+
+  bool cancelled() const noexcept {
+    return aborted_.load(std::memory_order_relaxed)
+      || (cancel_ && cancel_->load(std::memory_order_relaxed));
+  }
+
+  void abort(std::exception_ptr&& e) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!error_) {
+      error_ = std::move(e);
+    }
+
+    aborted_.store(true, std::memory_order_relaxed);
+  }
+
+  size_t size() const noexcept { return partitions_.size(); }
+
+  std::mutex& mutex() noexcept { return mutex_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief rethrow an exception thrown by any of the workers
+  /// @returns false if the execution was cancelled
+  //////////////////////////////////////////////////////////////////////////////
+  bool finish() {
+    if (error_) {
+      std::rethrow_exception(error_);
+    }
+
+    return !cancelled();
+  }
+
+ private:
+  std::vector<partition> partitions_;
+  std::atomic<size_t> next_{0};
+  std::atomic<bool> aborted_{false};
+  const std::atomic<bool>* cancel_;
+  std::exception_ptr error_;
+  std::mutex mutex_;
+}; // execution
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief run 'worker' on the calling thread and on up to 'concurrency - 1'
+///        threads of a specified pool, wait for all of them to finish
+/// @note pool tasks started after the caller is done exit immediately,
+///       i.e. a busy pool never delays a query
+////////////////////////////////////////////////////////////////////////////////
+void run_workers(
+    async_utils::thread_pool& pool,
+    size_t concurrency,
+    execution& exec,
+    const std::function<void()>& worker) {
+  struct shared_state {
+    std::mutex mutex;
+    std::condition_variable cond;
+    size_t active{0};
+    bool finished{false};
+  };
+
+  auto run = [&exec, &worker]() noexcept {
+    try {
+      worker();
+    } catch (...) {
+      exec.abort(std::current_exception());
+    }
+  };
+
+  auto state = std::make_shared<shared_state>();
+
+  for (size_t i = 1; i < concurrency; ++i) {
+    const bool scheduled = pool.run([state, &run]() {
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+
+        if (state->finished) {
+          return;
+        }
+
+        ++state->active;
+      }
+
+      auto release = make_finally([&state]() noexcept {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        --state->active;
+        state->cond.notify_all();
+      });
+
+      run();
+    });
+
+    if (!scheduled) {
+      break;
+    }
+  }
+
+  run();
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->cond.wait(lock, [&state]() noexcept { return !state->active; });
+  state->finished = true;
+}
+
+size_t concurrency(
+    const async_utils::thread_pool& pool,
+    const execution& exec,
+    const parallel_executor::options& opts) {
+  const size_t value = opts.concurrency
+    ? opts.concurrency
+    : pool.max_threads() + 1; // +1 for the calling thread
+
+  return std::min(value, exec.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief visit all documents of a partition matching a specified query
+/// @returns false if the execution was cancelled
+////////////////////////////////////////////////////////////////////////////////
+template<typename Visitor>
+bool visit(
+    const filter::prepared& query,
+    const index_reader& reader,
+    const order::prepared& ord,
+    const partition& part,
+    const execution& exec,
+    Visitor&& visitor) {
+  auto& segment = reader[part.segment];
+  auto it = segment.mask(query.execute(segment, ord, part.min, part.max));
+
+  for (size_t i = 1; it->next(); ++i) {
+    if (0 == i % CANCEL_CHECK_INTERVAL && exec.cancelled()) {
+      return false;
+    }
+
+    visitor(it->value(), *it);
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class top_k_collector
+/// @brief keeps up to 'limit' best documents in a binary heap,
+///        the worst document of a heap is at its top
+////////////////////////////////////////////////////////////////////////////////
+class top_k_collector {
+ public:
+  top_k_collector(const order::prepared& ord, size_t limit)
+    : ord_(&ord), limit_(limit) {
+    heap_.reserve(limit);
+  }
+
+  void collect(const byte_type* score, size_t segment, doc_id_t doc) {
+    if (heap_.size() < limit_) {
+      heap_.push_back({ bstring(score, ord_->score_size()), segment, doc });
+      std::push_heap(heap_.begin(), heap_.end(), less());
+    } else if (less(*ord_, score, segment, doc, heap_.front())) {
+      std::pop_heap(heap_.begin(), heap_.end(), less());
+      auto& back = heap_.back();
+      back.score.assign(score, ord_->score_size());
+      back.segment = segment;
+      back.doc = doc;
+      std::push_heap(heap_.begin(), heap_.end(), less());
+    }
+  }
+
+  void collect(const parallel_executor::scored_doc& doc) {
+    collect(doc.score.c_str(), doc.segment, doc.doc);
+  }
+
+  parallel_executor::scored_docs& docs() noexcept { return heap_; }
+
+  void sort() {
+    std::sort_heap(heap_.begin(), heap_.end(), less());
+  }
+
+ private:
+  static bool less(
+      const order::prepared& ord,
+      const byte_type* score, size_t segment, doc_id_t doc,
+      const parallel_executor::scored_doc& rhs) {
+    const auto* rhs_score = rhs.score.c_str();
+
+    if (ord.less(score, rhs_score)) {
+      return true;
+    }
+
+    if (ord.less(rhs_score, score)) {
+      return false;
+    }
+
+    return segment < rhs.segment || (segment == rhs.segment && doc < rhs.doc);
+  }
+
+  struct doc_less {
+    bool operator()(const parallel_executor::scored_doc& lhs,
+                    const parallel_executor::scored_doc& rhs) const {
+      return top_k_collector::less(*ord, lhs.score.c_str(), lhs.segment, lhs.doc, rhs);
+    }
+
+    const order::prepared* ord;
+  }; // doc_less
+
+  doc_less less() const noexcept { return { ord_ }; }
+
+  const order::prepared* ord_;
+  size_t limit_;
+  parallel_executor::scored_docs heap_;
+}; // top_k_collector
+
+}
+
+namespace iresearch {
+
+bool parallel_executor::top_k(
+    const filter::prepared& query,
+    const index_reader& reader,
+    const order::prepared& ord,
+    size_t limit,
+    scored_docs& result,
+    const options& opts /*= {}*/) const {
+  result.clear();
+
+  if (!limit) {
+    return true;
+  }
+
+  execution exec(reader, opts);
+  top_k_collector merged(ord, limit);
+  const bstring no_score(ord.score_size(), 0);
+
+  run_workers(*pool_, concurrency(*pool_, exec, opts), exec, [&]() {
+    top_k_collector local(ord, limit);
+
+    for (auto* part = exec.next(); part; part = exec.next()) {
+      visit(query, reader, ord, *part, exec,
+            [&](doc_id_t doc, const doc_iterator& it) {
+        const auto* score = irs::get<irs::score>(it);
+
+        local.collect(score && !score->is_default()
+                        ? score->evaluate()
+                        : no_score.c_str(),
+                      part->segment, doc);
+      });
+    }
+
+    std::lock_guard<std::mutex> lock(exec.mutex());
+    for (auto& doc : local.docs()) {
+      merged.collect(doc);
+    }
+  });
+
+  merged.sort();
+  result = std::move(merged.docs());
+
+  return exec.finish();
+}
+
+bool parallel_executor::collect(
+    const filter::prepared& query,
+    const index_reader& reader,
+    segment_docs& result,
+    const options& opts /*= {}*/) const {
+  result.clear();
+  result.reserve(reader.size());
+
+  for (auto& segment : reader) {
+    result.emplace_back(doc_limits::min() + segment.docs_count());
+  }
+
+  execution exec(reader, opts);
+
+  run_workers(*pool_, concurrency(*pool_, exec, opts), exec, [&]() {
+    for (auto* part = exec.next(); part; part = exec.next()) {
+      auto& docs = result[part->segment];
+
+      visit(query, reader, order::prepared::unordered(), *part, exec,
+            [&docs](doc_id_t doc, const doc_iterator&) noexcept {
+        docs.set(doc);
+      });
+    }
+  });
+
+  return exec.finish();
+}
+
+} // ROOT
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_PARALLEL_EXECUTOR_H
+#define IRESEARCH_PARALLEL_EXECUTOR_H
+
+#include <atomic>
+
+#include "search/filter.hpp"
+#include "utils/async_utils.hpp"
+#include "utils/bitset.hpp"
+#include "utils/noncopyable.hpp"
+
+namespace iresearch {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct parallel_executor_options
+/// @brief options of a single query execution
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API parallel_executor_options {
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief max number of workers processing a single query,
+  ///        0 - number of threads of the underlying pool plus the caller
+  //////////////////////////////////////////////////////////////////////////////
+  size_t concurrency{0};
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief segments having more documents are split into doc-id ranges
+  ///        of the specified size, 0 - never split segments
+  /// @note rounded up to a multiple of the bitset word size
+  //////////////////////////////////////////////////////////////////////////////
+  doc_id_t range_size{0};
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief query execution stops as soon as the flag is set
+  //////////////////////////////////////////////////////////////////////////////
+  const std::atomic<bool>* cancel{};
+}; // parallel_executor_options
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class parallel_executor
+/// @brief executes a prepared query over all segments of an index reader
+///        concurrently using a specified thread pool
+/// @note every query is split into partitions, i.e. whole segments or
+///       doc-id ranges of large segments, which are handed out to at most
+///       'parallel_executor_options::concurrency' workers, results of
+///       the workers are merged once all partitions are processed
+/// @note the calling thread takes part in the execution, hence a query
+///       makes progress even if all threads of a pool are busy
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API parallel_executor : private util::noncopyable {
+ public:
+  using options = parallel_executor_options;
+
+  struct scored_doc {
+    bstring score;
+    size_t segment; // offset of a segment in a reader
+    doc_id_t doc;
+  }; // scored_doc
+
+  using scored_docs = std::vector<scored_doc>;
+  using segment_docs = std::vector<bitset>; // one bitset per segment
+
+  explicit parallel_executor(async_utils::thread_pool& pool) noexcept
+    : pool_(&pool) {
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief collect up to 'limit' best matching documents
+  /// @param result documents ordered according to 'ord', ties are resolved
+  ///        by segment offset and document id
+  /// @returns false if the execution was cancelled
+  //////////////////////////////////////////////////////////////////////////////
+  bool top_k(
+    const filter::prepared& query,
+    const index_reader& reader,
+    const order::prepared& ord,
+    size_t limit,
+    scored_docs& result,
+    const options& opts = {}) const;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief collect all matching documents
+  /// @param result bitset of matching documents for every segment of a reader
+  /// @returns false if the execution was cancelled
+  //////////////////////////////////////////////////////////////////////////////
+  bool collect(
+    const filter::prepared& query,
+    const index_reader& reader,
+    segment_docs& result,
+    const options& opts = {}) const;
+
+ private:
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  async_utils::thread_pool* pool_;
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // parallel_executor
+
+} // ROOT
+
+#endif // IRESEARCH_PARALLEL_EXECUTOR_H
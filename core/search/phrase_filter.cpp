@@ -22,10 +22,12 @@
 
 #include "phrase_filter.hpp"
 
+#include "analysis/shingle_token_stream.hpp"
 #include "index/field_meta.hpp"
 #include "search/collectors.hpp"
 #include "search/filter_visitor.hpp"
 #include "search/phrase_iterator.hpp"
+#include "search/query_arena.hpp"
 #include "search/states_cache.hpp"
 
 namespace {
@@ -301,7 +303,7 @@ class fixed_phrase_query : public phrase_query<fixed_phrase_state> {
   doc_iterator::ptr execute(
       const sub_reader& rdr,
       const order::prepared& ord,
-      const attribute_provider* /*ctx*/) const override {
+      const attribute_provider* ctx) const override {
     using conjunction_t = conjunction<doc_iterator::ptr>;
     using phrase_iterator_t = phrase_iterator<
       conjunction_t,
@@ -351,7 +353,8 @@ class fixed_phrase_query : public phrase_query<fixed_phrase_state> {
       ++position;
     }
 
-    return memory::make_managed<phrase_iterator_t>(
+    return query_arena::make_managed<phrase_iterator_t>(
+        ctx,
         std::move(itrs),
         std::move(positions),
         rdr,
@@ -384,7 +387,7 @@ class variadic_phrase_query : public phrase_query<variadic_phrase_state> {
   doc_iterator::ptr execute(
       const sub_reader& rdr,
       const order::prepared& ord,
-      const attribute_provider* /*ctx*/) const override {
+      const attribute_provider* ctx) const override {
     using adapter_t = variadic_phrase_adapter;
     using disjunction_t = disjunction<doc_iterator::ptr, adapter_t, true>;
     using compound_doc_iterator_t = irs::compound_doc_iterator<adapter_t>;
@@ -453,7 +456,8 @@ class variadic_phrase_query : public phrase_query<variadic_phrase_state> {
     assert(term_state == phrase_state->terms.end());
 
     if (phrase_state->volatile_boost) {
-      return memory::make_managed<phrase_iterator_t<true>>(
+      return query_arena::make_managed<phrase_iterator_t<true>>(
+        ctx,
         std::move(conj_itrs),
         std::move(positions),
         rdr,
@@ -463,7 +467,8 @@ class variadic_phrase_query : public phrase_query<variadic_phrase_state> {
         boost());
     }
 
-    return memory::make_managed<phrase_iterator_t<false>>(
+    return query_arena::make_managed<phrase_iterator_t<false>>(
+      ctx,
       std::move(conj_itrs),
       std::move(positions),
       rdr,
@@ -484,7 +489,7 @@ filter::prepared::ptr by_phrase::prepare(
     const index_reader& index,
     const order::prepared& ord,
     boost_t boost,
-    const attribute_provider* /*ctx*/) const {
+    const attribute_provider* ctx) const {
   if (field().empty() || options().empty()) {
     // empty field or phrase
     return filter::prepared::empty();
@@ -502,16 +507,90 @@ filter::prepared::ptr by_phrase::prepare(
 
   // prepare phrase stats (collector for each term)
   if (options().simple()) {
-    return fixed_prepare_collect(index, ord, boost);
+    auto query = shingles_prepare(index, ord, boost, ctx);
+
+    if (query) {
+      return query;
+    }
+
+    return fixed_prepare_collect(index, ord, boost, ctx);
   }
 
-  return variadic_prepare_collect(index, ord, boost);
+  return variadic_prepare_collect(index, ord, boost, ctx);
+}
+
+filter::prepared::ptr by_phrase::shingles_prepare(
+    const index_reader& index,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const {
+  const auto phrase_size = options().size();
+  const auto first = options().begin();
+  const auto last = std::prev(options().end());
+
+  // shingles cover adjacent terms only
+  if (phrase_size < 2 || last->first - first->first + 1 != phrase_size) {
+    return nullptr;
+  }
+
+  // every segment has to have shingles for the field, otherwise
+  // phrase and shingle matches may differ
+  const string_ref field = this->field();
+  bool found = false;
+
+  for (const auto& segment : index) {
+    const auto* reader = segment.field(field);
+
+    if (!reader) {
+      continue;
+    }
+
+    const auto& meta = reader->meta();
+
+    if (required() != (meta.index_features & required()) ||
+        !meta.features.count(irs::type<phrase_shingles>::id())) {
+      return nullptr;
+    }
+
+    found = true;
+  }
+
+  if (!found) {
+    return nullptr;
+  }
+
+  auto shingle_at = [](decltype(first) it) {
+    const auto& lhs = std::get<by_term_options>(it->second).term;
+    const auto& rhs = std::get<by_term_options>(std::next(it)->second).term;
+    return make_shingle(lhs, rhs);
+  };
+
+  // 2 terms phrase turns into a single term lookup
+  if (2 == phrase_size) {
+    by_term query;
+    *query.mutable_field() = shingle_field(field);
+    query.mutable_options()->term = shingle_at(first);
+    query.boost(this->boost());
+
+    return query.prepare(index, ord, boost, ctx);
+  }
+
+  // longer phrases turn into a phrase of overlapping shingles
+  by_phrase query;
+  *query.mutable_field() = shingle_field(field);
+  for (auto it = first; it != last; ++it) {
+    query.mutable_options()->push_back<by_term_options>().term = shingle_at(it);
+  }
+  query.boost(this->boost());
+
+  return query.prepare(index, ord, boost, ctx);
 }
 
 filter::prepared::ptr by_phrase::fixed_prepare_collect(
     const index_reader& index,
     const order::prepared& ord,
-    boost_t boost) const {
+    boost_t boost,
+    const attribute_provider* ctx) const {
   const auto phrase_size = options().size();
   const auto is_ord_empty = ord.empty();
 
@@ -591,7 +670,8 @@ filter::prepared::ptr by_phrase::fixed_prepare_collect(
     ++term_idx;
   }
 
-  return memory::make_managed<fixed_phrase_query>(
+  return query_arena::make_managed<fixed_phrase_query>(
+    ctx,
     std::move(phrase_states),
     std::move(positions),
     std::move(stats),
@@ -601,7 +681,8 @@ filter::prepared::ptr by_phrase::fixed_prepare_collect(
 filter::prepared::ptr by_phrase::variadic_prepare_collect(
     const index_reader& index,
     const order::prepared& ord,
-    boost_t boost) const {
+    boost_t boost,
+    const attribute_provider* ctx) const {
   const auto phrase_size = options().size();
 
   // stats collectors
@@ -708,7 +789,8 @@ filter::prepared::ptr by_phrase::variadic_prepare_collect(
     ++collector;
   }
 
-  return memory::make_managed<variadic_phrase_query>(
+  return query_arena::make_managed<variadic_phrase_query>(
+    ctx,
     std::move(phrase_states),
     std::move(positions),
     std::move(stats),
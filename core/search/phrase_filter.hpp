@@ -180,6 +180,10 @@ class IRESEARCH_API by_phrase_options {
 ////////////////////////////////////////////////////////////////////////////////
 /// @class by_phrase
 /// @brief user-side phrase filter
+/// @note exact phrases of simple terms over a field indexed with the
+///       'phrase_shingles' feature are evaluated via the shingles companion
+///       field, scores then reflect statistics of shingles rather than of
+///       separate terms
 ////////////////////////////////////////////////////////////////////////////////
 class IRESEARCH_API by_phrase : public filter_base<by_phrase_options> {
  public:
@@ -201,15 +205,23 @@ class IRESEARCH_API by_phrase : public filter_base<by_phrase_options> {
     const attribute_provider* ctx) const override;
 
  private:
+  filter::prepared::ptr shingles_prepare(
+    const index_reader& index,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const;
+
   filter::prepared::ptr fixed_prepare_collect(
     const index_reader& index,
     const order::prepared& ord,
-    boost_t boost) const;
+    boost_t boost,
+    const attribute_provider* ctx) const;
 
   filter::prepared::ptr variadic_prepare_collect(
     const index_reader& index,
     const order::prepared& ord,
-    boost_t boost) const;
+    boost_t boost,
+    const attribute_provider* ctx) const;
 }; // by_phrase
 
 } // ROOT
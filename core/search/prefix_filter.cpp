@@ -24,6 +24,7 @@
 
 #include "shared.hpp"
 #include "search/limited_sample_collector.hpp"
+#include "search/query_arena.hpp"
 #include "search/states_cache.hpp"
 #include "analysis/token_attributes.hpp"
 #include "index/index_reader.hpp"
@@ -76,7 +77,8 @@ DEFINE_FACTORY_DEFAULT(by_prefix)
     boost_t boost,
     const string_ref& field,
     const bytes_ref& prefix,
-    size_t scored_terms_limit) {
+    size_t scored_terms_limit,
+    const attribute_provider* ctx /*= nullptr*/) {
   limited_sample_collector<term_frequency> collector(ord.empty() ? 0 : scored_terms_limit); // object for collecting order stats
   multiterm_query::states_t states(index);
   multiterm_visitor<multiterm_query::states_t> mtv(collector, states);
@@ -96,8 +98,8 @@ DEFINE_FACTORY_DEFAULT(by_prefix)
   std::vector<bstring> stats;
   collector.score(index, ord, stats);
 
-  return memory::make_managed<multiterm_query>(
-    std::move(states), std::move(stats),
+  return query_arena::make_managed<multiterm_query>(
+    ctx, std::move(states), std::move(stats),
     boost, sort::MergeType::AGGREGATE);
 }
 
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "query_arena.hpp"
+
+#include <algorithm>
+
+namespace {
+
+inline irs::byte_type* align_up(irs::byte_type* p, size_t alignment) noexcept {
+  assert(alignment && !(alignment & (alignment - 1)));
+  const auto value = reinterpret_cast<uintptr_t>(p);
+  return reinterpret_cast<irs::byte_type*>((value + alignment - 1) & ~(alignment - 1));
+}
+
+}
+
+namespace iresearch {
+
+query_arena::query_arena(
+    const attribute_provider* parent /*= nullptr*/,
+    size_t block_size /*= DEFAULT_BLOCK_SIZE*/)
+  : parent_(parent),
+    block_size_(std::max(block_size, size_t(1))) {
+}
+
+query_arena::~query_arena() {
+  reset();
+}
+
+void* query_arena::allocate(size_t size, size_t alignment) {
+  auto* p = align_up(pos_, alignment);
+
+  if (pos_ && p <= end_ && size_t(end_ - p) >= size) {
+    pos_ = p + size;
+    return p;
+  }
+
+  return allocate_block(size, alignment);
+}
+
+void* query_arena::allocate_block(size_t size, size_t alignment) {
+  const size_t block_size = std::max(block_size_, size + alignment);
+
+  blocks_.push_back({ std::make_unique<byte_type[]>(block_size), block_size });
+  capacity_ += block_size;
+
+  auto& block = blocks_.back();
+  auto* p = align_up(block.data.get(), alignment);
+  pos_ = p + size;
+  end_ = block.data.get() + block.size;
+
+  return p;
+}
+
+void query_arena::reset() noexcept {
+  for (auto* entry = cleanups_; entry; ) {
+    auto* next = entry->next; // 'entry' itself lives in the arena
+    entry->destroy(entry->ptr);
+    entry = next;
+  }
+  cleanups_ = nullptr;
+
+  if (blocks_.empty()) {
+    return;
+  }
+
+  blocks_.resize(1);
+  auto& block = blocks_.front();
+  capacity_ = block.size;
+  pos_ = block.data.get();
+  end_ = pos_ + block.size;
+}
+
+attribute* query_arena::get_mutable(type_info::type_id type) noexcept {
+  if (irs::type<query_arena>::id() == type) {
+    return this;
+  }
+
+  return parent_
+    ? const_cast<attribute_provider*>(parent_)->get_mutable(type)
+    : nullptr;
+}
+
+} // ROOT
@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_QUERY_ARENA_H
+#define IRESEARCH_QUERY_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "utils/attribute_provider.hpp"
+#include "utils/attributes.hpp"
+#include "utils/memory.hpp"
+#include "utils/noncopyable.hpp"
+
+namespace iresearch {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class query_arena
+/// @brief monotonic memory resource for objects living as long as a query,
+///        i.e. prepared filters and document iterators, memory is released
+///        in bulk by 'reset()' or by a destructor
+/// @note an arena is used by making it accessible via the 'attribute_provider'
+///       passed to 'filter::prepare(...)' and 'filter::prepared::execute(...)'
+/// @note objects created within an arena must not be used after the arena
+///       is reset, i.e. prepared filters and iterators must not outlive it
+/// @note not thread-safe, an arena must not be shared between threads
+///       executing the same query concurrently
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API query_arena final
+    : public attribute,
+      public attribute_provider,
+      private util::noncopyable {
+ public:
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 4096;
+
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::query_arena";
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief create an object of type 'T' within an arena accessible via a
+  ///        specified context or on the heap if there is no such arena
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename T, typename... Args>
+  static memory::managed_ptr<T> make_managed(
+      const attribute_provider* ctx,
+      Args&&... args) {
+    auto* arena = ctx
+      ? const_cast<query_arena*>(irs::get<query_arena>(*ctx))
+      : nullptr;
+
+    if (arena) {
+      return memory::to_managed<T, false>(
+        arena->create<T>(std::forward<Args>(args)...));
+    }
+
+    return memory::make_managed<T>(std::forward<Args>(args)...);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @param parent attributes not known to the arena are requested from it
+  /// @param block_size size of a memory block requested from the heap
+  //////////////////////////////////////////////////////////////////////////////
+  explicit query_arena(
+    const attribute_provider* parent = nullptr,
+    size_t block_size = DEFAULT_BLOCK_SIZE);
+  ~query_arena();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return pointer to uninitialized memory of a specified size and alignment
+  //////////////////////////////////////////////////////////////////////////////
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief create an object of type 'T' within an arena, the object is
+  ///        destroyed by 'reset()'
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename T, typename... Args>
+  T* create(Args&&... args) {
+    T* obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      cleanups_ = new (allocate(sizeof(cleanup), alignof(cleanup))) cleanup{
+        [](void* p) noexcept { static_cast<T*>(p)->~T(); }, obj, cleanups_ };
+    }
+
+    return obj;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief destroy all created objects in reverse order of their creation
+  ///        and release allocated memory, the first block is kept for reuse
+  //////////////////////////////////////////////////////////////////////////////
+  void reset() noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return total size of memory blocks requested from the heap
+  //////////////////////////////////////////////////////////////////////////////
+  size_t capacity() const noexcept { return capacity_; }
+
+  virtual attribute* get_mutable(type_info::type_id type) noexcept override;
+
+ private:
+  struct cleanup {
+    void (*destroy)(void*) noexcept;
+    void* ptr;
+    cleanup* next;
+  }; // cleanup
+
+  struct block {
+    std::unique_ptr<byte_type[]> data;
+    size_t size;
+  }; // block
+
+  void* allocate_block(size_t size, size_t alignment);
+
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  std::vector<block> blocks_;
+  byte_type* pos_{};
+  byte_type* end_{};
+  cleanup* cleanups_{}; // the most recently created object goes first
+  const attribute_provider* parent_;
+  size_t block_size_;
+  size_t capacity_{};
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // query_arena
+
+} // ROOT
+
+#endif // IRESEARCH_QUERY_ARENA_H
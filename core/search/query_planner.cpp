@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "query_planner.hpp"
+
+#include <algorithm>
+
+#include "index/index_reader.hpp"
+#include "search/bitset_doc_iterator.hpp"
+#include "search/query_arena.hpp"
+#include "utils/misc.hpp"
+
+namespace {
+
+using namespace irs;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief holds a bitset for 'bitset_doc_iterator' since the bitset has to be
+///        initialized before the iterator
+////////////////////////////////////////////////////////////////////////////////
+struct bitset_holder {
+  explicit bitset_holder(bitset&& set) noexcept
+    : set(std::move(set)) {
+  }
+
+  bitset set;
+}; // bitset_holder
+
+class materialized_iterator final
+    : private bitset_holder,
+      public bitset_doc_iterator {
+ public:
+  explicit materialized_iterator(bitset&& set) noexcept
+    : bitset_holder(std::move(set)),
+      bitset_doc_iterator(this->set.begin(), this->set.end()) {
+  }
+}; // materialized_iterator
+
+constexpr string_ref PLAN_NAMES[] {
+  "empty", "single", "leapfrog", "merge", "bitset"
+};
+
+static_assert(PLAN_TYPES == IRESEARCH_COUNTOF(PLAN_NAMES));
+
+}
+
+namespace iresearch {
+
+string_ref to_string(PlanType type) noexcept {
+  assert(size_t(type) < PLAN_TYPES);
+  return PLAN_NAMES[size_t(type)];
+}
+
+/*static*/ void query_planner::record(
+    const attribute_provider* ctx,
+    PlanType type) noexcept {
+  auto* stats = ctx
+    ? const_cast<plan_stats*>(irs::get<plan_stats>(*ctx))
+    : nullptr;
+
+  if (stats) {
+    ++stats->counts[size_t(type)];
+  }
+}
+
+/*static*/ bool query_planner::materialize_disjunction(
+    const sub_reader& segment,
+    size_t size,
+    cost::cost_t cost) noexcept {
+  return size >= MIN_BITSET_CLAUSES
+    && segment.docs_count()
+    && cost >= segment.docs_count() / DENSITY_RATIO;
+}
+
+/*static*/ bool query_planner::within_bound(
+    cost::cost_t lead_cost,
+    cost::cost_t cost) noexcept {
+  return lead_cost >= cost / LEAD_COST_RATIO;
+}
+
+/*static*/ bool query_planner::within_bound(
+    const attribute_provider* ctx,
+    cost::cost_t cost) noexcept {
+  auto* bound = ctx
+    ? const_cast<plan_bound*>(irs::get<plan_bound>(*ctx))
+    : nullptr;
+
+  if (!bound) {
+    // top level node
+    return true;
+  }
+
+  if (bound->lead_cost) {
+    return within_bound(bound->lead_cost, cost);
+  }
+
+  // let an enclosing node decide once the bound is known
+  bound->deferred_cost = bound->deferred
+    ? std::min(bound->deferred_cost, cost)
+    : cost;
+  bound->deferred = true;
+
+  return false;
+}
+
+/*static*/ bool query_planner::merge_terms(
+    const sub_reader& segment,
+    size_t size,
+    cost::cost_t cost) noexcept {
+  return size <= MAX_MERGE_TERMS
+    && !materialize_disjunction(segment, size, cost);
+}
+
+/*static*/ size_t query_planner::bitset_size(const sub_reader& segment) noexcept {
+  const auto docs_count = segment.docs_count();
+  return docs_count ? doc_limits::min() + docs_count : 0;
+}
+
+/*static*/ void query_planner::materialize(doc_iterator& it, bitset& set) {
+  constexpr size_t BATCH_SIZE = 128;
+  doc_id_t docs[BATCH_SIZE];
+
+  for (;;) {
+    const size_t count = it.next_batch(docs, nullptr, BATCH_SIZE);
+
+    for (size_t i = 0; i < count; ++i) {
+      assert(docs[i] < set.size());
+      set.set(docs[i]);
+    }
+
+    if (count < BATCH_SIZE) {
+      break;
+    }
+  }
+}
+
+/*static*/ doc_iterator::ptr query_planner::make_bitset_iterator(
+    bitset&& set,
+    const attribute_provider* ctx) {
+  if (set.none()) {
+    return doc_iterator::empty();
+  }
+
+  return query_arena::make_managed<materialized_iterator>(ctx, std::move(set));
+}
+
+} // ROOT
@@ -0,0 +1,229 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_QUERY_PLANNER_H
+#define IRESEARCH_QUERY_PLANNER_H
+
+#include <array>
+#include <atomic>
+
+#include "index/iterators.hpp"
+#include "search/cost.hpp"
+#include "utils/attribute_provider.hpp"
+#include "utils/attributes.hpp"
+#include "utils/bitset.hpp"
+
+namespace iresearch {
+
+struct sub_reader;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @enum PlanType
+/// @brief strategy chosen for evaluating a query node within a segment
+////////////////////////////////////////////////////////////////////////////////
+enum class PlanType : uint8_t {
+  EMPTY = 0, // nothing matches within a segment
+  SINGLE, // node reduced to a single clause
+  LEAPFROG, // clauses are advanced in lock-step, i.e. conjunction
+  MERGE, // clauses are merged on the fly, i.e. disjunction
+  BITSET // matches are materialized into a bitset
+}; // PlanType
+
+constexpr size_t PLAN_TYPES = size_t(PlanType::BITSET) + 1;
+
+IRESEARCH_API string_ref to_string(PlanType type) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct plan_stats
+/// @brief number of segments evaluated by every of the strategies, the planner
+///        reports its decisions to an instance accessible via the
+///        'attribute_provider' passed to 'filter::prepared::execute(...)'
+/// @note updated concurrently by queries executed for different segments
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API plan_stats final : attribute {
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::plan_stats";
+  }
+
+  uint64_t operator[](PlanType type) const noexcept {
+    return counts[size_t(type)];
+  }
+
+  std::array<std::atomic<uint64_t>, PLAN_TYPES> counts{};
+}; // plan_stats
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct plan_bound
+/// @brief cost of the cheapest clause accompanying a node within an enclosing
+///        conjunction or exclusion, i.e. how many documents of the node are
+///        expected to be read at most, an enclosing node makes it accessible
+///        via the 'attribute_provider' passed to nested nodes
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API plan_bound final : attribute {
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::plan_bound";
+  }
+
+  cost::cost_t lead_cost{}; // 0 - not known yet
+  cost::cost_t deferred_cost{}; // min cost of the deferred disjunctions
+  bool deferred{}; // a nested disjunction waits for 'lead_cost' to be known
+}; // plan_bound
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class query_planner
+/// @brief chooses per segment strategies of evaluating compound queries
+///        based on cost estimates of their clauses and a segment size
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API query_planner {
+ public:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief clauses matching at least 1/DENSITY_RATIO of the documents of a
+  ///        segment in total are considered dense, it's cheaper to
+  ///        materialize them into a bitset than to merge on the fly
+  //////////////////////////////////////////////////////////////////////////////
+  static constexpr cost::cost_t DENSITY_RATIO = 32;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief minimum number of clauses worth to be materialized, merging
+  ///        of just a couple of iterators is always cheap
+  //////////////////////////////////////////////////////////////////////////////
+  static constexpr size_t MIN_BITSET_CLAUSES = 3;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief maximum number of unscored terms of a multi-term query worth to
+  ///        be merged on the fly, a heap of many postings is more expensive
+  ///        than a 'term_reader::bit_union(...)' of them even if sparse
+  //////////////////////////////////////////////////////////////////////////////
+  static constexpr size_t MAX_MERGE_TERMS = 16;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief a disjunction nested into a conjunction or an exclusion is
+  ///        materialized only if its cost exceeds the cost of the cheapest
+  ///        accompanying clause at most LEAD_COST_RATIO times, otherwise
+  ///        just a fraction of the union is going to be read
+  //////////////////////////////////////////////////////////////////////////////
+  static constexpr cost::cost_t LEAD_COST_RATIO = 4;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief report a chosen strategy to 'plan_stats' if any accessible via
+  ///        a specified context
+  //////////////////////////////////////////////////////////////////////////////
+  static void record(const attribute_provider* ctx, PlanType type) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if an unscored disjunction of 'size' clauses having
+  ///          'cost' in total should be materialized into a bitset
+  //////////////////////////////////////////////////////////////////////////////
+  static bool materialize_disjunction(
+    const sub_reader& segment,
+    size_t size,
+    cost::cost_t cost) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if a disjunction having 'cost' is cheap enough to be
+  ///          materialized within a node led by a clause having 'lead_cost'
+  //////////////////////////////////////////////////////////////////////////////
+  static bool within_bound(
+    cost::cost_t lead_cost,
+    cost::cost_t cost) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if a disjunction having 'cost' is cheap enough to be
+  ///          materialized according to a 'plan_bound' accessible via a
+  ///          specified context, disjunctions outside of any bounded node
+  ///          are always materialized
+  /// @note a disjunction is marked as deferred if a bound is not known yet,
+  ///       an enclosing node may execute it once again as soon as it is
+  //////////////////////////////////////////////////////////////////////////////
+  static bool within_bound(
+    const attribute_provider* ctx,
+    cost::cost_t cost) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if 'size' unscored terms of a multi-term query matching
+  ///          'cost' documents in total should be merged on the fly rather
+  ///          than unioned into a bitset, i.e. there are few sparse terms
+  //////////////////////////////////////////////////////////////////////////////
+  static bool merge_terms(
+    const sub_reader& segment,
+    size_t size,
+    cost::cost_t cost) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if an unscored disjunction of specified iterators should
+  ///          be materialized into a bitset
+  /// @param ctx context a disjunction is executed within, see 'plan_bound'
+  /// @note costs of iterators are evaluated only if there are enough of them
+  /// @note 'Iterator' is either 'doc_iterator::ptr' or an adapter
+  ///       providing 'operator->'
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename Iterator>
+  static bool materialize_disjunction(
+      const sub_reader& segment,
+      const std::vector<Iterator>& itrs,
+      const attribute_provider* ctx) {
+    if (itrs.size() < MIN_BITSET_CLAUSES || !bitset_size(segment)) {
+      return false;
+    }
+
+    cost::cost_t total = 0;
+    for (auto& it : itrs) {
+      const auto est = cost::extract(*it.operator->(), 0);
+      total = cost::MAX - total > est ? total + est : cost::MAX;
+    }
+
+    return materialize_disjunction(segment, itrs.size(), total)
+      && within_bound(ctx, total);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns iterator over a union of specified iterators
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename Iterator>
+  static doc_iterator::ptr materialize(
+      const sub_reader& segment,
+      std::vector<Iterator>& itrs,
+      const attribute_provider* ctx) {
+    bitset set(bitset_size(segment));
+
+    for (auto& it : itrs) {
+      materialize(*it.operator->(), set);
+    }
+
+    return make_bitset_iterator(std::move(set), ctx);
+  }
+
+ private:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns number of bits required to materialize matches of a segment,
+  ///          0 for an empty segment
+  //////////////////////////////////////////////////////////////////////////////
+  static size_t bitset_size(const sub_reader& segment) noexcept;
+
+  static void materialize(doc_iterator& it, bitset& set);
+
+  static doc_iterator::ptr make_bitset_iterator(
+    bitset&& set,
+    const attribute_provider* ctx);
+}; // query_planner
+
+} // ROOT
+
+#endif // IRESEARCH_QUERY_PLANNER_H
@@ -0,0 +1,300 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "query_profile.hpp"
+
+#include <chrono>
+#include <ostream>
+
+#include "utils/type_limits.hpp"
+
+namespace {
+
+using namespace irs;
+
+using steady_clock = std::chrono::steady_clock;
+
+inline uint64_t elapsed_ns(steady_clock::time_point start) noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    steady_clock::now() - start).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class profiling_doc_iterator
+/// @brief accumulates statistics locally and publishes them to a profile
+///        node on destruction to avoid contention between segments
+////////////////////////////////////////////////////////////////////////////////
+class profiling_doc_iterator final : public doc_iterator {
+ public:
+  profiling_doc_iterator(
+      doc_iterator::ptr&& it,
+      query_profile::node& node) noexcept
+    : it_(std::move(it)),
+      node_(&node) {
+    assert(it_);
+  }
+
+  virtual ~profiling_doc_iterator() {
+    node_->iterate_ns += iterate_ns_;
+    node_->nexts += nexts_;
+    node_->seeks += seeks_;
+    node_->batches += batches_;
+    node_->docs += docs_;
+  }
+
+  virtual attribute* get_mutable(type_info::type_id type) noexcept override {
+    return it_->get_mutable(type);
+  }
+
+  virtual doc_id_t value() const override {
+    return it_->value();
+  }
+
+  virtual bool next() override {
+    const auto start = steady_clock::now();
+    const bool res = it_->next();
+    iterate_ns_ += elapsed_ns(start);
+    ++nexts_;
+    docs_ += size_t(res);
+    return res;
+  }
+
+  virtual doc_id_t seek(doc_id_t target) override {
+    const auto prev = it_->value();
+    const auto start = steady_clock::now();
+    const auto doc = it_->seek(target);
+    iterate_ns_ += elapsed_ns(start);
+    ++seeks_;
+    docs_ += size_t(prev != doc && !doc_limits::eof(doc));
+    return doc;
+  }
+
+  virtual size_t next_batch(doc_id_t* docs, uint32_t* freqs, size_t size) override {
+    const auto start = steady_clock::now();
+    const auto count = it_->next_batch(docs, freqs, size);
+    iterate_ns_ += elapsed_ns(start);
+    ++batches_;
+    docs_ += count;
+    return count;
+  }
+
+  // profiling must not change a plan, e.g. disable 'block_conjunction'
+  virtual bool has_native_batch() const noexcept override {
+    return it_->has_native_batch();
+  }
+
+ private:
+  doc_iterator::ptr it_;
+  query_profile::node* node_;
+  uint64_t iterate_ns_{};
+  uint64_t nexts_{};
+  uint64_t seeks_{};
+  uint64_t batches_{};
+  uint64_t docs_{};
+}; // profiling_doc_iterator
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class plan_context
+/// @brief exposes planner statistics of a profile node to a query being
+///        executed, other attributes are requested from a parent context
+////////////////////////////////////////////////////////////////////////////////
+class plan_context final : public attribute_provider {
+ public:
+  plan_context(
+      query_profile::node& node,
+      const attribute_provider* parent) noexcept
+    : node_(&node),
+      parent_(parent) {
+  }
+
+  virtual attribute* get_mutable(type_info::type_id type) noexcept override {
+    if (irs::type<plan_stats>::id() == type) {
+      return &node_->plans;
+    }
+
+    return parent_
+      ? const_cast<attribute_provider*>(parent_)->get_mutable(type)
+      : nullptr;
+  }
+
+ private:
+  query_profile::node* node_;
+  const attribute_provider* parent_;
+}; // plan_context
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class profiling_query
+/// @brief wraps iterators produced by a prepared query into profiling ones
+////////////////////////////////////////////////////////////////////////////////
+class profiling_query final : public filter::prepared {
+ public:
+  profiling_query(
+      filter::prepared::ptr&& query,
+      query_profile::node& node) noexcept
+    : filter::prepared(query->boost()),
+      query_(std::move(query)),
+      node_(&node) {
+  }
+
+  virtual doc_iterator::ptr execute(
+      const sub_reader& rdr,
+      const order::prepared& ord,
+      const attribute_provider* ctx) const override {
+    const plan_context plan_ctx(*node_, ctx);
+    const auto start = steady_clock::now();
+    auto it = query_->execute(rdr, ord, &plan_ctx);
+    node_->execute_ns += elapsed_ns(start);
+    ++node_->executions;
+
+    return memory::make_managed<profiling_doc_iterator>(std::move(it), *node_);
+  }
+
+ private:
+  filter::prepared::ptr query_;
+  query_profile::node* node_;
+}; // profiling_query
+
+void visit(
+    const query_profile::node& node,
+    size_t depth,
+    const query_profile::visitor_f& visitor) {
+  if (!visitor(node, depth)) {
+    return;
+  }
+
+  for (auto& child : node.children) {
+    visit(*child, depth + 1, visitor);
+  }
+}
+
+}
+
+namespace iresearch {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      query_profile implementation
+// -----------------------------------------------------------------------------
+
+query_profile::node::node(string_ref name)
+  : name(name) {
+}
+
+query_profile::query_profile()
+  : root_("query"),
+    current_(&root_) {
+}
+
+attribute* query_profile::get_mutable(type_info::type_id type) noexcept {
+  if (irs::type<query_profile>::id() == type) {
+    return this;
+  }
+
+  return parent_
+    ? const_cast<attribute_provider*>(parent_)->get_mutable(type)
+    : nullptr;
+}
+
+filter::prepared::ptr query_profile::prepare(
+    const filter& filter,
+    const index_reader& rdr,
+    const order::prepared& ord,
+    const attribute_provider* ctx /*= nullptr*/) {
+  assert(current_ == &root_);
+  parent_ = ctx;
+
+  return prepare_child(filter, rdr, ord, irs::no_boost(), this);
+}
+
+filter::prepared::ptr query_profile::prepare_child(
+    const filter& filter,
+    const index_reader& rdr,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const {
+  auto* parent = current_;
+  assert(parent);
+  parent->children.emplace_back(
+    memory::make_unique<node>(filter.type()().name()));
+  auto& child = *parent->children.back();
+
+  const auto start = steady_clock::now();
+  current_ = &child;
+  filter::prepared::ptr query;
+  try {
+    query = filter.prepare(rdr, ord, boost, ctx);
+  } catch (...) {
+    current_ = parent;
+    throw;
+  }
+  current_ = parent;
+  child.prepare_ns += elapsed_ns(start);
+
+  return memory::make_managed<profiling_query>(std::move(query), child);
+}
+
+void query_profile::visit(const visitor_f& visitor) const {
+  ::visit(root_, 0, visitor);
+}
+
+std::ostream& query_profile::dump(std::ostream& out) const {
+  visit([&out](const node& node, size_t depth) {
+    out << std::string(2*depth, ' ') << node.name
+        << " [prepare_ns=" << node.prepare_ns
+        << " executions=" << node.executions
+        << " execute_ns=" << node.execute_ns
+        << " iterate_ns=" << node.iterate_ns
+        << " nexts=" << node.nexts
+        << " seeks=" << node.seeks
+        << " batches=" << node.batches
+        << " docs=" << node.docs;
+
+    // strategies chosen by a planner if any
+    const char* delim = " plan=";
+    for (size_t i = 0; i < PLAN_TYPES; ++i) {
+      const auto type = static_cast<PlanType>(i);
+      if (const uint64_t count = node.plans[type]; count) {
+        out << delim << to_string(type) << ':' << count;
+        delim = ",";
+      }
+    }
+
+    out << "]\n";
+    return true;
+  });
+
+  return out;
+}
+
+filter::prepared::ptr prepare_profiled(
+    const filter& filter,
+    const index_reader& rdr,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) {
+  const auto* profile = ctx ? irs::get<query_profile>(*ctx) : nullptr;
+
+  if (!profile) {
+    return filter.prepare(rdr, ord, boost, ctx);
+  }
+
+  return profile->prepare_child(filter, rdr, ord, boost, ctx);
+}
+
+} // ROOT
@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_QUERY_PROFILE_H
+#define IRESEARCH_QUERY_PROFILE_H
+
+#include <atomic>
+#include <functional>
+#include <iosfwd>
+
+#include "search/filter.hpp"
+#include "search/query_planner.hpp"
+#include "utils/attributes.hpp"
+#include "utils/noncopyable.hpp"
+
+namespace iresearch {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class query_profile
+/// @brief collects execution statistics for every node of a prepared query,
+///        i.e. an equivalent of 'EXPLAIN ANALYZE' for filters
+/// @note profiling is enabled by making an instance of 'query_profile'
+///       accessible via the 'attribute_provider' passed to
+///       'filter::prepare(...)', the simplest way is to use
+///       'query_profile::prepare(...)'
+/// @note timings are inclusive, i.e. time of a node includes time spent
+///       in all its children
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API query_profile final
+    : public attribute,
+      public attribute_provider {
+ public:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @struct node
+  /// @brief statistics of a single node of a query tree
+  /// @note counters are updated concurrently by iterators created for
+  ///       different segments
+  //////////////////////////////////////////////////////////////////////////////
+  struct IRESEARCH_API node : private util::noncopyable {
+    explicit node(string_ref name);
+
+    std::string name; // filter type name
+    std::atomic<uint64_t> prepare_ns{}; // time spent in 'filter::prepare'
+    std::atomic<uint64_t> executions{}; // number of 'prepared::execute' calls
+    std::atomic<uint64_t> execute_ns{}; // time spent in 'prepared::execute'
+    std::atomic<uint64_t> iterate_ns{}; // time spent in 'next'/'seek'/'next_batch'
+    std::atomic<uint64_t> nexts{}; // number of 'doc_iterator::next' calls
+    std::atomic<uint64_t> seeks{}; // number of 'doc_iterator::seek' calls
+    std::atomic<uint64_t> batches{}; // number of 'doc_iterator::next_batch' calls
+    std::atomic<uint64_t> docs{}; // number of visited documents
+    plan_stats plans; // strategies chosen by a planner per segment
+    std::vector<std::unique_ptr<node>> children;
+  }; // node
+
+  using visitor_f = std::function<bool(const node&, size_t depth)>;
+
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::query_profile";
+  }
+
+  query_profile();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief prepare a specified filter with profiling enabled
+  /// @param ctx parent context, attributes not known to the profile
+  ///        are requested from it
+  //////////////////////////////////////////////////////////////////////////////
+  filter::prepared::ptr prepare(
+    const filter& filter,
+    const index_reader& rdr,
+    const order::prepared& ord,
+    const attribute_provider* ctx = nullptr);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief prepare a specified filter as a child of the currently prepared
+  ///        node and wrap the result into a profiling query
+  /// @note intended to be used by compound filters for their sub-filters
+  /// @note not thread-safe, 'filter::prepare' is single-threaded anyway
+  //////////////////////////////////////////////////////////////////////////////
+  filter::prepared::ptr prepare_child(
+    const filter& filter,
+    const index_reader& rdr,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const;
+
+  virtual attribute* get_mutable(type_info::type_id type) noexcept override;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return root of the collected profile, every child of the root
+  ///         corresponds to a filter prepared via 'prepare(...)'
+  //////////////////////////////////////////////////////////////////////////////
+  const node& root() const noexcept { return root_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief visit profile nodes in depth-first order
+  /// @note visitation of the node's children is skipped if visitor
+  ///       returns 'false'
+  //////////////////////////////////////////////////////////////////////////////
+  void visit(const visitor_f& visitor) const;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief write human-readable representation of a profile
+  //////////////////////////////////////////////////////////////////////////////
+  std::ostream& dump(std::ostream& out) const;
+
+ private:
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  node root_;
+  mutable node* current_;
+  const attribute_provider* parent_{};
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // query_profile
+
+inline std::ostream& operator<<(std::ostream& out, const query_profile& profile) {
+  return profile.dump(out);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// @brief prepare a specified filter, profile it if an instance of
+///        'query_profile' is accessible via a specified context
+//////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API filter::prepared::ptr prepare_profiled(
+  const filter& filter,
+  const index_reader& rdr,
+  const order::prepared& ord,
+  boost_t boost,
+  const attribute_provider* ctx);
+
+} // ROOT
+
+#endif // IRESEARCH_QUERY_PROFILE_H
@@ -27,6 +27,7 @@
 #include "index/index_reader.hpp"
 #include "search/filter_visitor.hpp"
 #include "search/limited_sample_collector.hpp"
+#include "search/query_arena.hpp"
 #include "search/term_filter.hpp"
 
 namespace {
@@ -129,7 +130,8 @@ DEFINE_FACTORY_DEFAULT(by_range)
     boost_t boost,
     const string_ref& field,
     const options_type::range_type& rng,
-    size_t scored_terms_limit) {
+    size_t scored_terms_limit,
+    const attribute_provider* ctx /*= nullptr*/) {
   //TODO: optimize unordered case
   // - seek to min
   // - get ordinal position of the term
@@ -142,7 +144,7 @@ DEFINE_FACTORY_DEFAULT(by_range)
 
     if (rng.min_type == rng.max_type && rng.min_type == BoundType::INCLUSIVE) {
       // degenerated case
-      return by_term::prepare(index, ord, boost, field, rng.min);
+      return by_term::prepare(index, ord, boost, field, rng.min, ctx);
     }
 
     // can't satisfy conditon
@@ -169,8 +171,8 @@ DEFINE_FACTORY_DEFAULT(by_range)
   std::vector<bstring> stats;
   collector.score(index, ord, stats);
 
-  return memory::make_managed<multiterm_query>(
-    std::move(states), std::move(stats),
+  return query_arena::make_managed<multiterm_query>(
+    ctx, std::move(states), std::move(stats),
     boost, sort::MergeType::AGGREGATE);
 }
 
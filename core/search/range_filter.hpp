@@ -87,7 +87,8 @@ class IRESEARCH_API by_range : public filter_base<by_range_options> {
     boost_t boost,
     const string_ref& field,
     const options_type::range_type& rng,
-    size_t scored_terms_limit);
+    size_t scored_terms_limit,
+    const attribute_provider* ctx = nullptr);
 
   static void visit(
     const sub_reader& segment,
@@ -101,10 +102,10 @@ class IRESEARCH_API by_range : public filter_base<by_range_options> {
       const index_reader& index,
       const order::prepared& ord,
       boost_t boost,
-      const attribute_provider* /*ctx*/) const override {
+      const attribute_provider* ctx) const override {
     return prepare(index, ord, this->boost()*boost,
                    field(), options().range,
-                   options().scored_terms_limit);
+                   options().scored_terms_limit, ctx);
   }
 }; // by_range 
 
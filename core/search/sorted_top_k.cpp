@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sorted_top_k.hpp"
+
+#include <algorithm>
+
+#include "index/comparer.hpp"
+#include "index/index_reader.hpp"
+
+namespace {
+
+using namespace irs;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns true if a document denoted by 'key', 'segment' and 'doc'
+///          precedes 'rhs'
+////////////////////////////////////////////////////////////////////////////////
+bool precedes(
+    const comparer& less,
+    const bytes_ref& key, size_t segment, doc_id_t doc,
+    const sorted_doc& rhs) {
+  const auto rhs_key = rhs.value();
+
+  if (less(key, rhs_key)) {
+    return true;
+  }
+
+  if (less(rhs_key, key)) {
+    return false;
+  }
+
+  return segment < rhs.segment || (segment == rhs.segment && doc < rhs.doc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class top_docs
+/// @brief keeps up to 'limit' top documents in a binary heap,
+///        the last of the top documents is at the top of a heap
+////////////////////////////////////////////////////////////////////////////////
+class top_docs {
+ public:
+  top_docs(const comparer& less, size_t limit, sorted_docs& docs)
+    : less_(&less), limit_(limit), docs_(&docs) {
+    assert(limit_);
+    docs_->clear();
+    docs_->reserve(limit_);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if a specified document would get into the top documents
+  //////////////////////////////////////////////////////////////////////////////
+  bool accepts(const bytes_ref& key, size_t segment, doc_id_t doc) const {
+    return docs_->size() < limit_
+      || precedes(*less_, key, segment, doc, docs_->front());
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @note a document must be accepted by 'accepts(...)'
+  //////////////////////////////////////////////////////////////////////////////
+  void push(const bytes_ref& key, size_t segment, doc_id_t doc) {
+    if (docs_->size() == limit_) {
+      std::pop_heap(docs_->begin(), docs_->end(), doc_less{less_});
+      docs_->pop_back();
+    }
+
+    docs_->push_back({ key.null() ? bstring() : bstring(key.c_str(), key.size()),
+                       !key.null(), segment, doc });
+    std::push_heap(docs_->begin(), docs_->end(), doc_less{less_});
+  }
+
+  void sort() {
+    std::sort_heap(docs_->begin(), docs_->end(), doc_less{less_});
+  }
+
+ private:
+  struct doc_less {
+    bool operator()(const sorted_doc& lhs, const sorted_doc& rhs) const {
+      return precedes(*less, lhs.value(), lhs.segment, lhs.doc, rhs);
+    }
+
+    const comparer* less;
+  }; // doc_less
+
+  const comparer* less_;
+  size_t limit_;
+  sorted_docs* docs_;
+}; // top_docs
+
+struct segment_entry {
+  const sub_reader* segment;
+  size_t offset; // offset of a segment in a reader
+  columnstore_reader::values_reader_f values;
+  bstring min; // least value of a sort column
+  bool has_min;
+}; // segment_entry
+
+bytes_ref key(const segment_entry& entry, doc_id_t doc, bytes_ref& value) {
+  return entry.values(doc, value) ? value : bytes_ref::NIL;
+}
+
+}
+
+namespace iresearch {
+
+size_t sorted_top_k(
+    const filter::prepared& query,
+    const index_reader& reader,
+    const comparer& less,
+    size_t limit,
+    sorted_docs& result) {
+  result.clear();
+
+  if (!limit) {
+    return 0;
+  }
+
+  std::vector<segment_entry> segments;
+  segments.reserve(reader.size());
+
+  for (size_t i = 0, size = reader.size(); i < size; ++i) {
+    auto& segment = reader[i];
+
+    if (!segment.live_docs_count()) {
+      continue;
+    }
+
+    const auto* column = segment.sort();
+
+    segments.push_back({
+      &segment, i,
+      column ? column->values() : columnstore_reader::empty_reader(),
+      {}, false });
+
+    // documents are ordered by a sort column, hence the
+    // least value belongs to the very first document
+    auto& entry = segments.back();
+    bytes_ref value;
+    const auto min = key(entry, doc_limits::min(), value);
+
+    if (!min.null()) {
+      entry.min.assign(min.c_str(), min.size());
+      entry.has_min = true;
+    }
+  }
+
+  // visit segments having the least values first
+  // for the result to be filled with best candidates early
+  std::stable_sort(
+    segments.begin(), segments.end(),
+    [&less](const segment_entry& lhs, const segment_entry& rhs) {
+      return less(lhs.has_min ? bytes_ref(lhs.min) : bytes_ref::NIL,
+                  rhs.has_min ? bytes_ref(rhs.min) : bytes_ref::NIL);
+  });
+
+  top_docs top(less, limit, result);
+  size_t visited = 0;
+  bytes_ref value;
+
+  for (auto& entry : segments) {
+    const bytes_ref min = entry.has_min ? bytes_ref(entry.min) : bytes_ref::NIL;
+
+    if (!top.accepts(min, entry.offset, doc_limits::min())) {
+      continue; // none of the segment documents can get into the result
+    }
+
+    auto it = entry.segment->mask(query.execute(*entry.segment));
+
+    while (it->next()) {
+      const doc_id_t doc = it->value();
+      const auto doc_key = key(entry, doc, value);
+      ++visited;
+
+      if (!top.accepts(doc_key, entry.offset, doc)) {
+        // subsequent documents have greater or equal keys
+        // and greater ids, none of them can get into the result
+        break;
+      }
+
+      top.push(doc_key, entry.offset, doc);
+    }
+  }
+
+  top.sort();
+
+  return visited;
+}
+
+} // ROOT
@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_SORTED_TOP_K_H
+#define IRESEARCH_SORTED_TOP_K_H
+
+#include "search/filter.hpp"
+#include "utils/string.hpp"
+
+namespace iresearch {
+
+class comparer;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct sorted_doc
+/// @brief document collected by 'sorted_top_k'
+////////////////////////////////////////////////////////////////////////////////
+struct sorted_doc {
+  bytes_ref value() const noexcept {
+    return has_key ? bytes_ref(key) : bytes_ref::NIL;
+  }
+
+  bstring key; // value of a sort column
+  bool has_key; // false if a document has no value in a sort column
+  size_t segment; // offset of a segment in a reader
+  doc_id_t doc;
+}; // sorted_doc
+
+using sorted_docs = std::vector<sorted_doc>;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief collect up to 'limit' matching documents having the least values
+///        of the sort column according to 'less', i.e. the top documents
+///        of an index sorted by 'less'
+/// @param less comparer the index is sorted by, i.e. the one specified
+///        in 'index_writer::init_options::comparator'
+/// @param result documents ordered according to 'less', ties are resolved
+///        by segment offset and document id
+/// @returns number of visited matches
+/// @note documents of a sorted segment are physically ordered by 'less',
+///       hence a segment stops being iterated as soon as its next match
+///       can't get into the result, i.e. after at most 'limit' matches,
+///       segments are visited in order of their least sort values and
+///       skipped entirely if the least value can't get into the result
+/// @note in order to get the greatest values first, e.g. the most recent
+///       events, an index has to be sorted in descending order
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API size_t sorted_top_k(
+  const filter::prepared& query,
+  const index_reader& reader,
+  const comparer& less,
+  size_t limit,
+  sorted_docs& result);
+
+} // ROOT
+
+#endif // IRESEARCH_SORTED_TOP_K_H
@@ -25,6 +25,7 @@
 #include "index/index_reader.hpp"
 #include "search/filter_visitor.hpp"
 #include "search/collectors.hpp"
+#include "search/query_arena.hpp"
 #include "search/term_query.hpp"
 
 namespace {
@@ -118,7 +119,8 @@ DEFINE_FACTORY_DEFAULT(by_term)
     const order::prepared& ord,
     boost_t boost,
     const string_ref& field,
-    const bytes_ref& term) {
+    const bytes_ref& term,
+    const attribute_provider* ctx /*= nullptr*/) {
   term_query::states_t states(index);
   field_collectors field_stats(ord);
   term_collectors term_stats(ord, 1);
@@ -144,8 +146,8 @@ DEFINE_FACTORY_DEFAULT(by_term)
 
   term_stats.finish(stats_buf, 0, field_stats, index);
 
-  return memory::make_managed<term_query>(
-    std::move(states), std::move(stats), boost);
+  return query_arena::make_managed<term_query>(
+    ctx, std::move(states), std::move(stats), boost);
 }
 
 } // ROOT
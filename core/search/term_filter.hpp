@@ -62,7 +62,8 @@ class IRESEARCH_API by_term : public filter_base<by_term_options> {
     const order::prepared& ord,
     boost_t boost,
     const string_ref& field,
-    const bytes_ref& term);
+    const bytes_ref& term,
+    const attribute_provider* ctx = nullptr);
 
   static void visit(
     const sub_reader& segment,
@@ -76,9 +77,9 @@ class IRESEARCH_API by_term : public filter_base<by_term_options> {
       const index_reader& rdr,
       const order::prepared& ord,
       boost_t boost,
-      const attribute_provider* /*ctx*/) const override {
+      const attribute_provider* ctx) const override {
     return prepare(rdr, ord, boost*this->boost(),
-                   field(), options().term);
+                   field(), options().term, ctx);
   }
 }; // by_term
 
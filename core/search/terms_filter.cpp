@@ -28,6 +28,7 @@
 #include "search/term_filter.hpp"
 #include "search/filter_visitor.hpp"
 #include "search/multiterm_query.hpp"
+#include "search/query_arena.hpp"
 
 namespace {
 
@@ -120,7 +121,7 @@ filter::prepared::ptr by_terms::prepare(
     const index_reader& index,
     const order::prepared& order,
     boost_t boost,
-    const attribute_provider* /*ctx*/) const {
+    const attribute_provider* ctx) const {
   boost *= this->boost();
   const auto& terms = options().terms;
   const size_t size = terms.size();
@@ -131,7 +132,7 @@ filter::prepared::ptr by_terms::prepare(
 
   if (1 == size) {
     const auto term = terms.begin();
-    return by_term::prepare(index, order, boost*term->boost, field(), term->term);
+    return by_term::prepare(index, order, boost*term->boost, field(), term->term, ctx);
   }
 
   field_collectors field_stats(order);
@@ -149,8 +150,8 @@ filter::prepared::ptr by_terms::prepare(
     term_stats.finish(stats_buf, term_idx++, field_stats, index);
   }
 
-  return memory::make_managed<multiterm_query>(
-    std::move(states), std::move(stats),
+  return query_arena::make_managed<multiterm_query>(
+    ctx, std::move(states), std::move(stats),
     boost, sort::MergeType::AGGREGATE);
 }
 
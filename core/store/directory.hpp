@@ -27,9 +27,11 @@
 #include "data_output.hpp"
 #include "utils/memory.hpp"
 #include "utils/noncopyable.hpp"
+#include "utils/range.hpp"
 #include "utils/string.hpp"
 
 #include <ctime>
+#include <functional>
 #include <vector>
 
 namespace iresearch {
@@ -213,6 +215,24 @@ struct IRESEARCH_API directory : private util::noncopyable {
   ////////////////////////////////////////////////////////////////////////////
   virtual bool sync(const std::string& name) noexcept = 0;
 
+  ////////////////////////////////////////////////////////////////////////////
+  /// @brief ensures that all modification of the specified files have been
+  ///        sucessfully persisted, implementations are free to sync files
+  ///        in any order and concurrently
+  /// @param[in] files names of the files
+  /// @returns call success
+  ////////////////////////////////////////////////////////////////////////////
+  virtual bool sync_files(
+      range<const std::reference_wrapper<const std::string>> files) noexcept {
+    for (auto& file : files) {
+      if (!sync(file)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   ////////////////////////////////////////////////////////////////////////////
   /// @brief applies the specified 'visitor' to every filename in a directory
   /// @param[in] visitor to be applied
@@ -32,6 +32,11 @@
 #include "utils/utf8_path.hpp"
 #include "utils/file_utils.hpp"
 #include "utils/crc.hpp"
+#include "utils/async_utils.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 #ifdef _WIN32
   #include <Windows.h> // for GetLastError()
@@ -65,6 +70,20 @@ inline int get_posix_fadvice(irs::IOAdvice advice) {
   return IR_FADVICE_NORMAL;
 }
 
+// fsync is mostly waiting for the device, a few concurrent
+// requests let the device/filesystem merge the flushes
+constexpr size_t MAX_SYNC_THREADS = 8;
+
+//////////////////////////////////////////////////////////////////////////////
+/// @returns a pool shared by all directories for syncing files concurrently,
+///          a calling thread takes part in syncing as well
+//////////////////////////////////////////////////////////////////////////////
+irs::async_utils::thread_pool& sync_pool() {
+  static irs::async_utils::thread_pool pool(
+    MAX_SYNC_THREADS - 1, MAX_SYNC_THREADS - 1);
+
+  return pool;
+}
 
 }
 
@@ -638,5 +657,82 @@ bool fs_directory::sync(const std::string& name) noexcept {
   return false;
 }
 
+bool fs_directory::sync_files(
+    range<const std::reference_wrapper<const std::string>> files) noexcept {
+  const size_t num_threads = std::min(files.size(), MAX_SYNC_THREADS);
+
+  if (num_threads < 2) {
+    return directory::sync_files(files);
+  }
+
+  // counters are atomic so that syncing never depends on 'mutex' which is
+  // used only for waking up the waiting thread
+  struct sync_state {
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::atomic<size_t> next{0}; // next file to sync
+    std::atomic<size_t> active{0}; // number of threads syncing files
+    std::atomic<bool> success{true};
+  };
+
+  std::shared_ptr<sync_state> state;
+
+  try {
+    state = std::make_shared<sync_state>();
+  } catch (...) {
+    return directory::sync_files(files);
+  }
+
+  // tasks may be picked up by the pool after the files are synced,
+  // they neither access 'files' nor 'this' in that case
+  auto sync_next = [this, files, state]() noexcept {
+    ++state->active; // before picking a file for the waiting thread to see it
+
+    for (size_t i; state->success && (i = state->next++) < files.size(); ) {
+      if (!sync(files[i])) {
+        state->success = false;
+      }
+    }
+
+    if (0 == --state->active) {
+      try {
+        // ensure the waiting thread either observes 'active' or is notified
+        auto lock = make_lock_guard(state->mutex);
+      } catch (...) {
+        // the waiting thread rechecks 'active' periodically
+      }
+
+      state->cond.notify_all();
+    }
+  };
+
+  try {
+    for (size_t i = 1; i < num_threads; ++i) {
+      if (!sync_pool().run(sync_next)) {
+        break; // pool is stopped
+      }
+    }
+  } catch (...) {
+    // failed to schedule tasks, sync remaining files in the current thread
+  }
+
+  sync_next(); // current thread takes part as well
+
+  // wait for files being synced by the pool
+  try {
+    auto lock = make_unique_lock(state->mutex);
+
+    while (!state->cond.wait_for(lock, std::chrono::milliseconds(100),
+                                 [&state]() noexcept { return !state->active; })) {
+    }
+  } catch (...) {
+    while (state->active) {
+      std::this_thread::yield();
+    }
+  }
+
+  return state->success;
+}
+
 MSVC_ONLY(__pragma(warning(pop)))
 }
@@ -71,6 +71,13 @@ class IRESEARCH_API fs_directory : public directory {
 
   virtual bool sync(const std::string& name) noexcept override;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief syncs files concurrently, fsync latency rather than bandwidth
+  ///        usually dominates when many small files are to be persisted
+  //////////////////////////////////////////////////////////////////////////////
+  virtual bool sync_files(
+    range<const std::reference_wrapper<const std::string>> files) noexcept override;
+
   virtual bool visit(const visitor_f& visitor) const override;
 
  private:
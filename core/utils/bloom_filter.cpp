@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "bloom_filter.hpp"
+
+#include <absl/hash/internal/city.h>
+
+#include "error/error.hpp"
+#include "store/data_input.hpp"
+#include "store/data_output.hpp"
+#include "utils/attributes.hpp"
+#include "utils/math_utils.hpp"
+#include "utils/string_utils.hpp"
+
+namespace {
+
+constexpr uint32_t MAX_PROBES = 30;
+
+// second hash used for double hashing within a block
+FORCE_INLINE uint32_t delta(uint32_t hash) noexcept {
+  return (hash >> 17) | (hash << 15);
+}
+
+}
+
+namespace iresearch {
+
+REGISTER_ATTRIBUTE(term_bloom_filter);
+
+/*static*/ uint64_t bloom_filter::hash(const bytes_ref& key) noexcept {
+  return absl::hash_internal::CityHash64(
+    reinterpret_cast<const char*>(key.c_str()), key.size());
+}
+
+bloom_filter::bloom_filter(size_t num_keys, size_t bits_per_key) {
+  const size_t num_bits = std::max(num_keys*bits_per_key, BLOCK_BITS);
+  blocks_.resize(math::div_ceil64(num_bits, BLOCK_BITS));
+
+  // optimal number of probes is ln(2)*bits_per_key
+  num_probes_ = std::min(
+    std::max(uint32_t(0.69*bits_per_key), uint32_t(1)),
+    MAX_PROBES);
+}
+
+void bloom_filter::insert(uint64_t hash) noexcept {
+  auto& block = blocks_[this->block(hash)];
+  uint32_t h = uint32_t(hash);
+  const uint32_t step = delta(h);
+
+  for (uint32_t i = 0; i < num_probes_; ++i, h += step) {
+    const uint32_t bit = h % BLOCK_BITS;
+    block[bit / 64] |= uint64_t(1) << (bit % 64);
+  }
+}
+
+bool bloom_filter::may_contain(uint64_t hash) const noexcept {
+  auto& block = blocks_[this->block(hash)];
+  uint32_t h = uint32_t(hash);
+  const uint32_t step = delta(h);
+
+  for (uint32_t i = 0; i < num_probes_; ++i, h += step) {
+    const uint32_t bit = h % BLOCK_BITS;
+
+    if (0 == (block[bit / 64] & (uint64_t(1) << (bit % 64)))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void bloom_filter::write(data_output& out) const {
+  out.write_vint(num_probes_);
+  out.write_vlong(blocks_.size());
+
+  for (auto& block : blocks_) {
+    for (const uint64_t word : block) {
+      out.write_long(word);
+    }
+  }
+}
+
+void bloom_filter::read(data_input& in) {
+  const uint32_t num_probes = in.read_vint();
+  const size_t num_blocks = in.read_vlong();
+
+  if (!num_probes || num_probes > MAX_PROBES || !num_blocks) {
+    throw index_error(string_utils::to_string(
+      "invalid bloom filter, probes '%u', blocks '" IR_SIZE_T_SPECIFIER "'",
+      num_probes, num_blocks));
+  }
+
+  std::vector<block_t> blocks(num_blocks);
+
+  for (auto& block : blocks) {
+    for (uint64_t& word : block) {
+      word = in.read_long();
+    }
+  }
+
+  blocks_ = std::move(blocks);
+  num_probes_ = num_probes;
+}
+
+}
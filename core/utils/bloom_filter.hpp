@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_BLOOM_FILTER_H
+#define IRESEARCH_BLOOM_FILTER_H
+
+#include <array>
+#include <vector>
+
+#include "shared.hpp"
+#include "utils/string.hpp"
+
+namespace iresearch {
+
+struct data_input;
+struct data_output;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct term_bloom_filter
+/// @brief field feature requesting a term dictionary to keep a Bloom filter
+///        over the terms of a field, exact term lookups then reject most of
+///        the absent terms without accessing a term index, e.g. lookups of
+///        primary keys in segments not containing them
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API term_bloom_filter {
+  // DO NOT CHANGE NAME
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::term_bloom_filter";
+  }
+}; // term_bloom_filter
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class bloom_filter
+/// @brief blocked Bloom filter, all probes of a key hit a single 512-bit block
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API bloom_filter {
+ public:
+  static constexpr size_t BLOCK_BITS = 512;
+  static constexpr size_t DEFAULT_BITS_PER_KEY = 10; // ~1% false positives
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns hash of a specified key, stable across processes and platforms
+  //////////////////////////////////////////////////////////////////////////////
+  static uint64_t hash(const bytes_ref& key) noexcept;
+
+  bloom_filter() = default;
+  explicit bloom_filter(
+    size_t num_keys,
+    size_t bits_per_key = DEFAULT_BITS_PER_KEY);
+
+  bool empty() const noexcept { return blocks_.empty(); }
+
+  void insert(uint64_t hash) noexcept;
+  void insert(const bytes_ref& key) noexcept {
+    insert(hash(key));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns false if a key is definitely absent
+  //////////////////////////////////////////////////////////////////////////////
+  bool may_contain(uint64_t hash) const noexcept;
+  bool may_contain(const bytes_ref& key) const noexcept {
+    return may_contain(hash(key));
+  }
+
+  void write(data_output& out) const;
+  void read(data_input& in);
+
+ private:
+  using block_t = std::array<uint64_t, BLOCK_BITS / 64>;
+
+  // maps upper half of a hash onto [0, blocks_.size())
+  size_t block(uint64_t hash) const noexcept {
+    assert(!blocks_.empty());
+    return ((hash >> 32) * blocks_.size()) >> 32;
+  }
+
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  std::vector<block_t> blocks_;
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+  uint32_t num_probes_{};
+}; // bloom_filter
+
+}
+
+#endif // IRESEARCH_BLOOM_FILTER_H
@@ -24,8 +24,11 @@
 #include "directory_utils.hpp"
 #include "index/index_meta.hpp"
 #include "formats/formats.hpp"
+#include "store/fs_directory.hpp"
 #include "utils/attributes.hpp"
+#include "utils/file_utils.hpp"
 #include "utils/log.hpp"
+#include "utils/utf8_path.hpp"
 
 namespace iresearch {
 namespace directory_utils {
@@ -247,6 +250,64 @@ directory_cleaner::removal_acceptor_t remove_except_current_segments(
   return std::bind(acceptor, std::placeholders::_1, std::move(retain));
 }
 
+bool copy(
+    const directory& src,
+    const std::string& src_name,
+    directory& dst,
+    const std::string& dst_name) {
+  constexpr size_t BUFFER_SIZE = 65536;
+
+  // files of filesystem based directories are copied within the kernel
+  auto* src_fs = dynamic_cast<const fs_directory*>(&src);
+  auto* dst_fs = dynamic_cast<const fs_directory*>(&dst);
+
+  if (src_fs && dst_fs) {
+    utf8_path src_path;
+    utf8_path dst_path;
+    (src_path/=src_fs->directory())/=src_name;
+    (dst_path/=dst_fs->directory())/=dst_name;
+
+    if (!file_utils::copy(src_path.c_str(), dst_path.c_str())) {
+      IR_FRMT_ERROR("Failed to copy file, path: %s", src_name.c_str());
+      return false;
+    }
+
+    return true;
+  }
+
+  auto in = src.open(src_name, IOAdvice::SEQUENTIAL | IOAdvice::READONCE);
+
+  if (!in) {
+    IR_FRMT_ERROR("Failed to open input file, path: %s", src_name.c_str());
+    return false;
+  }
+
+  auto out = dst.create(dst_name);
+
+  if (!out) {
+    IR_FRMT_ERROR("Failed to create output file, path: %s", dst_name.c_str());
+    return false;
+  }
+
+  auto buf = std::make_unique<byte_type[]>(BUFFER_SIZE);
+
+  for (auto left = in->length(); left;) {
+    const auto size = in->read_bytes(buf.get(), std::min(left, BUFFER_SIZE));
+
+    if (!size) {
+      IR_FRMT_ERROR("Failed to read input file, path: %s", src_name.c_str());
+      return false;
+    }
+
+    out->write_bytes(buf.get(), size);
+    left -= size;
+  }
+
+  out->close();
+
+  return true;
+}
+
 }
 
 // -----------------------------------------------------------------------------
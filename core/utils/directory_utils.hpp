@@ -98,6 +98,21 @@ IRESEARCH_API directory_cleaner::removal_acceptor_t remove_except_current_segmen
   const directory& dir, const format& codec
 );
 
+// ----------------------------------------------------------------------------
+// --SECTION--                                                  file copy utils
+// ----------------------------------------------------------------------------
+
+// copy contents of a file 'src_name' from 'src' to a file 'dst_name' in 'dst'
+// as is, i.e. without decryption/encryption, data is not transferred via
+// user space if both directories are filesystem based
+// return success
+IRESEARCH_API bool copy(
+  const directory& src,
+  const std::string& src_name,
+  directory& dst,
+  const std::string& dst_name
+);
+
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -167,6 +182,11 @@ struct IRESEARCH_API tracking_directory final : public directory {
     return impl_.sync(name);
   }
 
+  virtual bool sync_files(
+      range<const std::reference_wrapper<const std::string>> files) noexcept override {
+    return impl_.sync_files(files);
+  }
+
   virtual bool visit(const visitor_f& visitor) const override {
     return impl_.visit(visitor);
   }
@@ -239,6 +259,11 @@ struct IRESEARCH_API ref_tracking_directory: public directory {
     return impl_.sync(name);
   }
 
+  virtual bool sync_files(
+      range<const std::reference_wrapper<const std::string>> files) noexcept override {
+    return impl_.sync_files(files);
+  }
+
   virtual bool visit(const visitor_f& visitor) const override {
     return impl_.visit(visitor);
   }
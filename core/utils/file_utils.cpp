@@ -31,6 +31,7 @@
 #include "utils/locale_utils.hpp"
 #include "utils/log.hpp"
 #include "utils/memory.hpp"
+#include "utils/misc.hpp"
 
 #if defined(__APPLE__)
   #include <sys/param.h> // for MAXPATHLEN
@@ -52,6 +53,10 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+
 #endif // _WIN32
 
 namespace {
@@ -950,6 +955,71 @@ bool mkdir(const file_path_t path, bool createNew) noexcept {
   return true;
 }
 
+bool copy(const file_path_t src_path, const file_path_t dst_path) noexcept {
+  #ifdef _WIN32
+    return 0 != ::CopyFileW(src_path, dst_path, FALSE);
+  #else
+    const int in = ::open(src_path, O_RDONLY);
+
+    if (in < 0) {
+      return false;
+    }
+
+    auto close_in = make_finally([in]() noexcept { ::close(in); });
+    struct stat info;
+
+    if (0 != ::fstat(in, &info)) {
+      return false;
+    }
+
+    const int out = ::open(dst_path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+    if (out < 0) {
+      return false;
+    }
+
+    auto left = static_cast<uint64_t>(info.st_size);
+
+    #if defined(__linux__) && defined(__GLIBC__) \
+        && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+      // both offsets are advanced, fallbacks below proceed from where
+      // the previous attempt stopped, e.g. EXDEV on kernels before 5.3
+      for (ssize_t size; left; left -= uint64_t(size)) {
+        size = ::copy_file_range(in, nullptr, out, nullptr, size_t(left), 0);
+
+        if (size <= 0) {
+          break;
+        }
+      }
+    #endif
+
+    #ifdef __linux__
+      for (ssize_t size; left; left -= uint64_t(size)) {
+        size = ::sendfile(out, in, nullptr, size_t(left));
+
+        if (size <= 0) {
+          break;
+        }
+      }
+    #endif
+
+    constexpr size_t BUFFER_SIZE = 65536;
+    char buf[BUFFER_SIZE];
+
+    while (left) {
+      const auto size = ::read(in, buf, size_t(std::min(left, uint64_t(BUFFER_SIZE))));
+
+      if (size <= 0 || size != ::write(out, buf, size_t(size))) {
+        break;
+      }
+
+      left -= uint64_t(size);
+    }
+
+    return 0 == ::close(out) && !left;
+  #endif
+}
+
 bool move(const file_path_t src_path, const file_path_t dst_path) noexcept {
   // FIXME TODO ensure both functions lead to the same result in all cases @see utf8_path_tests::rename() tests
   #ifdef _WIN32
@@ -144,6 +144,10 @@ handle_t open(void* file, OpenMode mode, int advice) noexcept;
 
 bool mkdir(const file_path_t path, bool createNew) noexcept;  // recursive directory creation
 
+// copy contents of a file, data is transferred within the kernel
+// (copy_file_range/sendfile/CopyFile) where supported
+bool copy(const file_path_t src_path, const file_path_t dst_path) noexcept;
+
 bool move(const file_path_t src_path, const file_path_t dst_path) noexcept;
 
 size_t fread(void* fd, void* buf, size_t size);
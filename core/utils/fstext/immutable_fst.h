@@ -80,7 +80,16 @@ class ImmutableFstImpl : public internal::FstImpl<A> {
 
   size_t NumOutputEpsilons(StateId) const noexcept { return 0; }
 
-  static std::shared_ptr<ImmutableFstImpl<Arc>> Read(irs::data_input& strm);
+  static std::shared_ptr<ImmutableFstImpl<Arc>> Read(
+    irs::data_input& strm,
+    bool use_buffer);
+
+  static bool Skip(irs::index_input& strm);
+
+  // Heap memory occupied by states, arcs and copied weights.
+  size_t MemoryUsage() const noexcept {
+    return nstates_*sizeof(State) + narcs_*sizeof(Arc) + weights_size_;
+  }
 
   const Arc* Arcs(StateId s) const noexcept { return states_[s].arcs; }
 
@@ -116,7 +125,8 @@ class ImmutableFstImpl : public internal::FstImpl<A> {
 
   std::unique_ptr<State[]> states_;
   std::unique_ptr<Arc[]> arcs_;
-  std::unique_ptr<irs::byte_type[]> weights_;
+  std::unique_ptr<irs::byte_type[]> weights_; // empty if weights are referenced in place
+  size_t weights_size_{};                      // Size of 'weights_'.
   size_t narcs_;                               // Number of arcs.
   StateId nstates_;                            // Number of states.
   StateId start_;                              // Initial state.
@@ -127,7 +137,8 @@ class ImmutableFstImpl : public internal::FstImpl<A> {
 
 template<typename Arc>
 std::shared_ptr<ImmutableFstImpl<Arc>> ImmutableFstImpl<Arc>::Read(
-    irs::data_input& stream) {
+    irs::data_input& stream,
+    bool use_buffer) {
   auto impl = std::make_shared<ImmutableFstImpl<Arc>>();
 
   // read header
@@ -143,18 +154,16 @@ std::shared_ptr<ImmutableFstImpl<Arc>> ImmutableFstImpl<Arc>::Read(
 
   auto states = std::make_unique<State[]>(nstates);
   auto arcs = std::make_unique<Arc[]>(narcs);
-  auto weights = std::make_unique<irs::byte_type[]>(total_weight_size);
 
-  // read states & arcs
-  auto* weight = weights.get();
+  // read states & arcs, weights are bound to the actual data later
+  constexpr const irs::byte_type* kUnbound = nullptr;
   auto* arc = arcs.get();
   for (auto state = states.get(), end = state + nstates; state != end; ++state) {
     state->arcs = arc;
 
     size_t weight_size = stream.read_vlong();
     const bool has_arcs = !irs::shift_unpack_64(weight_size, weight_size);
-    state->weight = { weight, weight_size };
-    weight += weight_size;
+    state->weight = { kUnbound, weight_size };
 
     if (has_arcs) {
       state->narcs = static_cast<uint32_t>(stream.read_byte()) + 1;
@@ -162,17 +171,40 @@ std::shared_ptr<ImmutableFstImpl<Arc>> ImmutableFstImpl<Arc>::Read(
       for (auto* end = arc + state->narcs; arc != end; ++arc) {
         arc->ilabel = stream.read_byte();
         arc->nextstate = stream.read_vint();
-        const size_t weight_size = stream.read_vlong();
-        arc->weight = { weight, weight_size };
-        weight += weight_size;
+        arc->weight = { kUnbound, size_t(stream.read_vlong()) };
       }
     } else {
       state->narcs = 0;
     }
   }
 
-  // read weights
-  stream.read_bytes(weights.get(), total_weight_size);
+  // read weights, reference them in place if possible
+  std::unique_ptr<irs::byte_type[]> weights;
+  const irs::byte_type* weights_data = use_buffer
+    ? stream.read_buffer(total_weight_size, irs::BufferHint::PERSISTENT)
+    : nullptr;
+
+  if (!weights_data) {
+    weights = std::make_unique<irs::byte_type[]>(total_weight_size);
+    stream.read_bytes(weights.get(), total_weight_size);
+    weights_data = weights.get();
+  }
+
+  // bind weights, they are stored in the same order as states & arcs
+  auto* weight = weights_data;
+  arc = arcs.get();
+  for (auto state = states.get(), end = state + nstates; state != end; ++state) {
+    const size_t weight_size = state->weight.Size();
+    state->weight = { weight, weight_size };
+    weight += weight_size;
+
+    for (auto* end = arc + state->narcs; arc != end; ++arc) {
+      const size_t weight_size = arc->weight.Size();
+      arc->weight = { weight, weight_size };
+      weight += weight_size;
+    }
+  }
+  assert(weight == weights_data + total_weight_size);
 
   // noexcept block
   impl->properties_ = props;
@@ -182,10 +214,45 @@ std::shared_ptr<ImmutableFstImpl<Arc>> ImmutableFstImpl<Arc>::Read(
   impl->states_ = std::move(states);
   impl->arcs_ = std::move(arcs);
   impl->weights_ = std::move(weights);
+  impl->weights_size_ = impl->weights_ ? total_weight_size : 0;
 
   return impl;
 }
 
+template<typename Arc>
+bool ImmutableFstImpl<Arc>::Skip(irs::index_input& stream) {
+  // read header
+  if (Version(stream.read_byte()) != Version::MIN) {
+    return false;
+  }
+
+  stream.read_long(); // props
+  const size_t total_weight_size = stream.read_long();
+  const StateId nstates = stream.read_int();
+  stream.read_vint(); // start
+  irs::read_zvlong(stream); // narcs
+
+  // skip states & arcs without materializing them
+  for (StateId state = 0; state < nstates; ++state) {
+    size_t weight_size = stream.read_vlong();
+
+    if (!irs::shift_unpack_64(weight_size, weight_size)) {
+      const size_t narcs = static_cast<uint32_t>(stream.read_byte()) + 1;
+
+      for (size_t arc = 0; arc < narcs; ++arc) {
+        stream.read_byte(); // ilabel
+        stream.read_vint(); // nextstate
+        stream.read_vlong(); // weight size
+      }
+    }
+  }
+
+  // skip weights
+  stream.seek(stream.file_pointer() + total_weight_size);
+
+  return true;
+}
+
 template<typename A>
 class ImmutableFst : public ImplToExpandedFst<ImmutableFstImpl<A>> {
  public:
@@ -212,11 +279,27 @@ class ImmutableFst : public ImplToExpandedFst<ImmutableFstImpl<A>> {
     return new ImmutableFst<A>(*this, safe);
   }
 
-  static ImmutableFst<A>* Read(irs::data_input& strm) {
-    auto impl = Impl::Read(strm);
+  //////////////////////////////////////////////////////////////////////////////
+  /// @param use_buffer reference weights directly in a persistent buffer of
+  ///        'strm' if available instead of copying, 'strm' must outlive FST
+  //////////////////////////////////////////////////////////////////////////////
+  static ImmutableFst<A>* Read(irs::data_input& strm, bool use_buffer = false) {
+    auto impl = Impl::Read(strm, use_buffer);
     return impl ? new ImmutableFst<A>(std::move(impl)) : nullptr;
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief positions 'strm' right after the FST without reading it
+  /// @returns false if 'strm' doesn't point to a valid FST
+  //////////////////////////////////////////////////////////////////////////////
+  static bool Skip(irs::index_input& strm) {
+    return Impl::Skip(strm);
+  }
+
+  size_t MemoryUsage() const noexcept {
+    return GetImpl()->MemoryUsage();
+  }
+
   // for OpenFST API compliance
   static ImmutableFst<A>* Read(std::istream& strm,
                                const FstReadOptions& /*opts*/) {
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_RADIX_SORT_H
+#define IRESEARCH_RADIX_SORT_H
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "shared.hpp"
+#include "string.hpp"
+
+namespace iresearch {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief stable most-significant-digit radix sort of a specified range by
+///        byte strings returned by 'key', i.e. in 'memcmp' order with
+///        shorter strings going first
+/// @param key functor returning 'bytes_ref' for a given element, returned
+///        values must stay valid while sorting
+/// @note buckets smaller than 'Threshold' are sorted via 'std::stable_sort'
+///       comparing the remaining suffixes of the keys
+////////////////////////////////////////////////////////////////////////////////
+template<size_t Threshold = 32, typename T, typename Key>
+void msd_radix_sort(std::vector<T>& values, const Key& key) {
+  struct bucket {
+    size_t begin;
+    size_t end;
+    size_t depth; // offset of a byte to distribute by
+  };
+
+  if (values.size() < 2) {
+    return;
+  }
+
+  std::vector<T> buf(values.size());
+  std::vector<bucket> stack{ { 0, values.size(), 0 } };
+  std::array<size_t, 257> counts; // 0 - exhausted key, 1 + byte otherwise
+
+  auto digit = [&key](const T& value, size_t depth) noexcept -> size_t {
+    const bytes_ref k = key(value);
+    return depth < k.size() ? 1 + size_t(k[depth]) : 0;
+  };
+
+  while (!stack.empty()) {
+    const auto [begin, end, depth] = stack.back();
+    stack.pop_back();
+
+    if (end - begin < Threshold) {
+      std::stable_sort(
+        values.begin() + begin, values.begin() + end,
+        [&key, depth = depth](const T& lhs, const T& rhs) {
+          const bytes_ref lhs_key = key(lhs);
+          const bytes_ref rhs_key = key(rhs);
+          return bytes_ref(lhs_key.c_str() + depth, lhs_key.size() - depth)
+            < bytes_ref(rhs_key.c_str() + depth, rhs_key.size() - depth);
+      });
+      continue;
+    }
+
+    counts.fill(0);
+    for (size_t i = begin; i < end; ++i) {
+      ++counts[digit(values[i], depth)];
+    }
+
+    // whole range shares the same byte, go deeper without moving anything
+    const size_t first = digit(values[begin], depth);
+    if (counts[first] == end - begin) {
+      if (first) {
+        stack.push_back({ begin, end, depth + 1 });
+      }
+      continue;
+    }
+
+    // turn counts into offsets of the buckets
+    size_t offset = begin;
+    for (auto& count : counts) {
+      const size_t size = count;
+      count = offset;
+      offset += size;
+    }
+
+    for (size_t i = begin; i < end; ++i) {
+      buf[counts[digit(values[i], depth)]++] = std::move(values[i]);
+    }
+
+    std::move(buf.begin() + begin, buf.begin() + end, values.begin() + begin);
+
+    // 'counts[i]' now denotes the end of the i-th bucket, exhausted
+    // keys are equal and don't need to be sorted any further
+    for (size_t i = 1; i < counts.size(); ++i) {
+      const size_t bucket_begin = counts[i - 1];
+      const size_t bucket_end = counts[i];
+
+      if (bucket_end - bucket_begin > 1) {
+        stack.push_back({ bucket_begin, bucket_end, depth + 1 });
+      }
+    }
+  }
+}
+
+} // ROOT
+
+#endif // IRESEARCH_RADIX_SORT_H
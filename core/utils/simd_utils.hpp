@@ -329,6 +329,53 @@ template<
   }
 }
 
+// Intersects strictly increasing sequences [lhs;lhs+lhs_size) and
+// [rhs;rhs+rhs_size), every 'lhs' value is compared against a whole
+// block of 'rhs' values at once. 'out' may alias 'lhs'.
+// Returns number of values written to 'out'
+template<
+  typename T,
+  typename = std::enable_if_t<std::is_integral_v<T>>
+> size_t intersect(
+    const T* lhs, size_t lhs_size,
+    const T* rhs, size_t rhs_size,
+    T* out) noexcept {
+  constexpr HWY_FULL(T) simd_tag;
+  constexpr size_t Step = MaxLanes(simd_tag);
+
+  const T* lhs_end = lhs + lhs_size;
+  const T* rhs_end = rhs + rhs_size;
+  const T* out_begin = out;
+
+  while (lhs != lhs_end && rhs + Step <= rhs_end) {
+    const T value = *lhs;
+
+    if (rhs[Step-1] < value) {
+      rhs += Step;
+      continue;
+    }
+
+    // 'value' may only reside within [rhs;rhs+Step)
+    *out = value;
+    out += !AllFalse(Set(simd_tag, value) == LoadU(simd_tag, rhs));
+    ++lhs;
+  }
+
+  // merge the tail
+  while (lhs != lhs_end && rhs != rhs_end) {
+    if (*lhs < *rhs) {
+      ++lhs;
+    } else if (*rhs < *lhs) {
+      ++rhs;
+    } else {
+      *out++ = *lhs++;
+      ++rhs;
+    }
+  }
+
+  return size_t(out - out_begin);
+}
+
 }
 }
 
@@ -0,0 +1,289 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <mutex>
+
+#include "analysis/token_attributes.hpp"
+#include "formats/columnstore2.hpp"
+#include "formats/sparse_bitmap.hpp"
+#include "index/index_meta.hpp"
+#include "store/memory_directory.hpp"
+#include "utils/compression.hpp"
+#include "utils/math_utils.hpp"
+
+namespace {
+
+using irs::columnstore2::ColumnType;
+
+constexpr irs::doc_id_t MAX_DOCS = 1 << 20;
+constexpr int64_t DENSITY_STEPS[] { 1, 2, 16, 1024 };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     columnstore2
+// -----------------------------------------------------------------------------
+
+struct column_store {
+  irs::memory_directory dir;
+  irs::segment_meta meta{"microbench", nullptr};
+  irs::columnstore2::reader reader;
+}; // column_store
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns single column store containing values of the specified type for
+///          every 'step' document out of 'MAX_DOCS'
+/// @note stores are written once per process and then cached
+////////////////////////////////////////////////////////////////////////////////
+const column_store& make_column_store(ColumnType type, irs::doc_id_t step) {
+  static std::mutex mutex;
+  static std::map<std::pair<ColumnType, irs::doc_id_t>, std::unique_ptr<column_store>> cache;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& store = cache[std::make_pair(type, step)];
+
+  if (store) {
+    return *store;
+  }
+
+  store = irs::memory::make_unique<column_store>();
+
+  // only consolidating writer produces 'DENSE_FIXED' columns
+  irs::columnstore2::writer writer(ColumnType::DENSE_FIXED == type);
+  writer.prepare(store->dir, store->meta);
+
+  auto [id, column] = writer.push_column({
+    irs::type<irs::compression::none>::get(), {}, false });
+  UNUSED(id);
+
+  for (irs::doc_id_t doc = irs::doc_limits::min(); doc <= MAX_DOCS; doc += step) {
+    auto& out = column(doc);
+
+    switch (type) {
+      case ColumnType::MASK:
+        break;
+      case ColumnType::FIXED:
+      case ColumnType::DENSE_FIXED:
+        out.write_int(doc);
+        break;
+      case ColumnType::SPARSE: {
+        const auto str = std::to_string(doc);
+        out.write_bytes(reinterpret_cast<const irs::byte_type*>(str.c_str()), str.size());
+      } break;
+    }
+  }
+
+  irs::flush_state state;
+  state.doc_count = MAX_DOCS;
+  state.name = store->meta.name;
+
+  writer.commit(state);
+  store->reader.prepare(store->dir, store->meta);
+
+  return *store;
+}
+
+void types_and_steps(benchmark::internal::Benchmark* b) {
+  for (auto type : { ColumnType::SPARSE, ColumnType::MASK,
+                     ColumnType::FIXED, ColumnType::DENSE_FIXED }) {
+    for (auto step : DENSITY_STEPS) {
+      b->Args({int64_t(type), step});
+    }
+  }
+}
+
+// args: column type, step between documents having a value
+void BM_column_next(benchmark::State& state) {
+  auto& store = make_column_store(ColumnType(state.range(0)), state.range(1));
+  auto* column = store.reader.column(0);
+
+  if (!column) {
+    state.SkipWithError("missing column");
+    return;
+  }
+
+  size_t docs = 0;
+  for (auto _ : state) {
+    auto it = column->iterator();
+    auto* payload = irs::get<irs::payload>(*it);
+
+    while (it->next()) {
+      if (payload) {
+        benchmark::DoNotOptimize(payload->value);
+      }
+      ++docs;
+    }
+  }
+
+  state.SetItemsProcessed(docs);
+}
+
+BENCHMARK(BM_column_next)->Apply(types_and_steps);
+
+// args: column type, step between documents having a value, distance between seeks
+void BM_column_seek(benchmark::State& state) {
+  auto& store = make_column_store(ColumnType(state.range(0)), state.range(1));
+  auto* column = store.reader.column(0);
+  const irs::doc_id_t skip = state.range(2);
+
+  if (!column) {
+    state.SkipWithError("missing column");
+    return;
+  }
+
+  size_t seeks = 0;
+  for (auto _ : state) {
+    auto it = column->iterator();
+    auto* payload = irs::get<irs::payload>(*it);
+
+    for (irs::doc_id_t target = irs::doc_limits::min();
+         !irs::doc_limits::eof(it->seek(target));
+         target += skip) {
+      if (payload) {
+        benchmark::DoNotOptimize(payload->value);
+      }
+      ++seeks;
+    }
+  }
+
+  state.SetItemsProcessed(seeks);
+}
+
+BENCHMARK(BM_column_seek)->Apply([](benchmark::internal::Benchmark* b) {
+  for (auto type : { ColumnType::SPARSE, ColumnType::MASK,
+                     ColumnType::FIXED, ColumnType::DENSE_FIXED }) {
+    for (auto step : { 1, 16 }) {
+      for (auto skip : { 3, 100, 10000 }) {
+        b->Args({int64_t(type), step, skip});
+      }
+    }
+  }
+});
+
+// args: column type, step between documents having a value
+void BM_column_values(benchmark::State& state) {
+  const irs::doc_id_t step = state.range(1);
+  auto& store = make_column_store(ColumnType(state.range(0)), step);
+  auto* column = store.reader.column(0);
+
+  if (!column) {
+    state.SkipWithError("missing column");
+    return;
+  }
+
+  // point lookups in a pseudo-random order, any odd multiplier
+  // gives a permutation of [0, MAX_DOCS) since MAX_DOCS is a power of 2
+  constexpr uint64_t MULTIPLIER = 999983;
+  static_assert(irs::math::is_power2(MAX_DOCS));
+
+  size_t lookups = 0;
+  for (auto _ : state) {
+    auto values = column->values();
+    irs::bytes_ref value;
+
+    for (irs::doc_id_t i = 0; i < MAX_DOCS; i += step) {
+      const irs::doc_id_t doc = irs::doc_limits::min() + (i * MULTIPLIER) % MAX_DOCS;
+      benchmark::DoNotOptimize(values(doc, value));
+      ++lookups;
+    }
+  }
+
+  state.SetItemsProcessed(lookups);
+}
+
+BENCHMARK(BM_column_values)->Apply(types_and_steps);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    sparse_bitmap
+// -----------------------------------------------------------------------------
+
+struct bitmap {
+  irs::memory_directory dir;
+  std::vector<irs::sparse_bitmap_writer::block> index;
+  irs::cost::cost_t count{};
+}; // bitmap
+
+const bitmap& make_bitmap(irs::doc_id_t step) {
+  static std::mutex mutex;
+  static std::map<irs::doc_id_t, std::unique_ptr<bitmap>> cache;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& entry = cache[step];
+
+  if (entry) {
+    return *entry;
+  }
+
+  entry = irs::memory::make_unique<bitmap>();
+
+  auto out = entry->dir.create("bitmap");
+  irs::sparse_bitmap_writer writer(*out);
+
+  for (irs::doc_id_t doc = irs::doc_limits::min(); doc <= MAX_DOCS; doc += step) {
+    writer.push_back(doc);
+    ++entry->count;
+  }
+
+  writer.finish();
+  entry->index = writer.index();
+
+  return *entry;
+}
+
+// args: step between documents in a bitmap
+void BM_sparse_bitmap_next(benchmark::State& state) {
+  auto& bitmap = make_bitmap(state.range(0));
+  auto in = bitmap.dir.open("bitmap", irs::IOAdvice::NORMAL);
+
+  size_t docs = 0;
+  for (auto _ : state) {
+    in->seek(0);
+    irs::sparse_bitmap_iterator it{in.get(), {{}, false}, bitmap.count};
+
+    while (it.next()) {
+      benchmark::DoNotOptimize(it.value());
+      ++docs;
+    }
+  }
+
+  state.SetItemsProcessed(docs);
+}
+
+BENCHMARK(BM_sparse_bitmap_next)->Arg(1)->Arg(2)->Arg(16)->Arg(1024)->Arg(65536);
+
+// args: step between documents in a bitmap, distance between seeks
+void BM_sparse_bitmap_seek(benchmark::State& state, bool use_block_index) {
+  auto& bitmap = make_bitmap(state.range(0));
+  const irs::doc_id_t skip = state.range(1);
+  auto in = bitmap.dir.open("bitmap", irs::IOAdvice::NORMAL);
+
+  const irs::sparse_bitmap_iterator::options opts {
+    { bitmap.index.data(), bitmap.index.size() },
+    use_block_index };
+
+  size_t seeks = 0;
+  for (auto _ : state) {
+    in->seek(0);
+    irs::sparse_bitmap_iterator it{in.get(), opts, bitmap.count};
+
+    for (irs::doc_id_t target = irs::doc_limits::min();
+         !irs::doc_limits::eof(it.seek(target));
+         target += skip) {
+      benchmark::DoNotOptimize(it.value());
+      ++seeks;
+    }
+  }
+
+  state.SetItemsProcessed(seeks);
+}
+
+void steps_and_skips(benchmark::internal::Benchmark* b) {
+  for (auto step : { 1, 2, 16, 1024 }) {
+    for (auto skip : { 3, 100, 10000, 100000 }) {
+      b->Args({step, skip});
+    }
+  }
+}
+
+BENCHMARK_CAPTURE(BM_sparse_bitmap_seek, block_index, true)->Apply(steps_and_skips);
+BENCHMARK_CAPTURE(BM_sparse_bitmap_seek, no_block_index, false)->Apply(steps_and_skips);
+
+}
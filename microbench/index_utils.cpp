@@ -0,0 +1,227 @@
+#include "index_utils.hpp"
+
+#include <map>
+#include <mutex>
+
+#include "tests_config.hpp"
+#include "analysis/delimited_token_stream.hpp"
+#include "formats/formats.hpp"
+#include "index/index_writer.hpp"
+#include "utils/utf8_path.hpp"
+
+namespace {
+
+class string_field final : public tests::field_base {
+ public:
+  string_field(irs::string_ref name, std::string value)
+    : value_(std::move(value)) {
+    this->name(static_cast<std::string>(name));
+    this->index_features_ = irs::IndexFeatures::FREQ;
+  }
+
+  void value(std::string value) { value_ = std::move(value); }
+
+  virtual irs::token_stream& get_tokens() const override {
+    stream_.reset(value_);
+    return stream_;
+  }
+
+  virtual bool write(irs::data_output& out) const override {
+    irs::write_string(out, value_);
+    return true;
+  }
+
+ private:
+  std::string value_;
+  mutable irs::string_token_stream stream_;
+}; // string_field
+
+class text_field final : public tests::field_base {
+ public:
+  explicit text_field(irs::string_ref name)
+    : stream_(" ") {
+    this->name(static_cast<std::string>(name));
+    this->index_features_ = irs::IndexFeatures::FREQ | irs::IndexFeatures::POS;
+  }
+
+  void value(std::string value) { value_ = std::move(value); }
+
+  virtual irs::token_stream& get_tokens() const override {
+    stream_.reset(value_);
+    return stream_;
+  }
+
+  virtual bool write(irs::data_output& out) const override {
+    irs::write_string(out, value_);
+    return true;
+  }
+
+ private:
+  std::string value_;
+  mutable irs::analysis::delimited_token_stream stream_;
+}; // text_field
+
+// <title>\t<date>\t<body>
+struct europarl_doc_template final : tests::delim_doc_generator::doc_template {
+  virtual void init() override {
+    clear();
+    title = std::make_shared<string_field>("title", "");
+    body = std::make_shared<text_field>(microbench::BODY);
+    insert(title);
+    insert(body);
+  }
+
+  virtual void value(size_t idx, const std::string& value) override {
+    switch (idx) {
+      case 0:
+        title->value(value);
+        break;
+      case 2:
+        body->value(value);
+        break;
+    }
+  }
+
+  std::shared_ptr<string_field> title;
+  std::shared_ptr<text_field> body;
+}; // europarl_doc_template
+
+std::unique_ptr<microbench::index> build_index(
+    tests::doc_generator_base& gen,
+    irs::string_ref format) {
+  static std::once_flag init;
+  std::call_once(init, [](){ irs::formats::init(); });
+
+  auto codec = irs::formats::get(format);
+
+  if (!codec) {
+    throw std::invalid_argument("unknown format");
+  }
+
+  auto index = irs::memory::make_unique<microbench::index>();
+  auto writer = irs::index_writer::make(index->dir, codec, irs::OM_CREATE);
+
+  for (const tests::document* doc; (doc = gen.next()) != nullptr;) {
+    tests::insert(*writer,
+                  doc->indexed.begin(), doc->indexed.end(),
+                  doc->stored.begin(), doc->stored.end());
+  }
+
+  writer->commit();
+  index->reader = irs::directory_reader::open(index->dir, codec);
+
+  return index;
+}
+
+template<typename Factory>
+const microbench::index& cached_index(std::string key, Factory&& factory) {
+  static std::mutex mutex;
+  static std::map<std::string, std::unique_ptr<microbench::index>> cache;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& index = cache[key];
+
+  if (!index) {
+    index = factory();
+  }
+
+  return *index;
+}
+
+}
+
+namespace microbench {
+
+std::string step_term(size_t step) {
+  return "step" + std::to_string(step);
+}
+
+std::string id_term(size_t doc) {
+  auto str = std::to_string(doc);
+  return std::string(std::max(size_t(10), str.size()) - str.size(), '0') + str;
+}
+
+synthetic_doc_generator::synthetic_doc_generator(size_t docs)
+  : docs_(docs) {
+}
+
+const tests::document* synthetic_doc_generator::next() {
+  if (next_ > docs_) {
+    return nullptr;
+  }
+
+  const auto doc = next_++;
+
+  doc_.clear();
+  doc_.insert(std::make_shared<string_field>(ID, id_term(doc)));
+
+  for (auto step : STEPS) {
+    if (0 == doc % step) {
+      doc_.insert(std::make_shared<string_field>(BODY, step_term(step)), true, false);
+    }
+  }
+
+  return &doc_;
+}
+
+const index& synthetic_index(size_t docs, irs::string_ref format /*= "1_4"*/) {
+  return cached_index(
+    "synthetic/" + std::to_string(docs) + "/" + static_cast<std::string>(format),
+    [docs, format](){
+      synthetic_doc_generator gen(docs);
+      return build_index(gen, format);
+  });
+}
+
+const index& europarl_index(irs::string_ref format /*= "1_4"*/) {
+  return cached_index(
+    "europarl/" + static_cast<std::string>(format),
+    [format](){
+      irs::utf8_path path(IResearch_test_resource_dir);
+      path /= "europarl.subset.txt";
+
+      europarl_doc_template doc;
+      tests::delim_doc_generator gen(path, doc);
+      return build_index(gen, format);
+  });
+}
+
+std::vector<irs::bstring> terms(
+    const irs::sub_reader& segment,
+    irs::string_ref field) {
+  std::vector<irs::bstring> terms;
+
+  auto* reader = segment.field(field);
+
+  if (reader) {
+    terms.reserve(reader->size());
+
+    for (auto it = reader->iterator(irs::SeekMode::NORMAL); it->next();) {
+      terms.emplace_back(it->value());
+    }
+  }
+
+  return terms;
+}
+
+irs::doc_iterator::ptr postings(
+    const irs::sub_reader& segment,
+    irs::string_ref field,
+    irs::string_ref term,
+    irs::IndexFeatures features /*= irs::IndexFeatures::NONE*/) {
+  auto* reader = segment.field(field);
+
+  if (!reader) {
+    return irs::doc_iterator::empty();
+  }
+
+  auto it = reader->iterator(irs::SeekMode::RANDOM_ONLY);
+
+  if (!it->seek(irs::ref_cast<irs::byte_type>(term))) {
+    return irs::doc_iterator::empty();
+  }
+
+  return it->postings(features);
+}
+
+}
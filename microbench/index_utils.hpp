@@ -0,0 +1,85 @@
+#ifndef IRESEARCH_MICROBENCH_INDEX_UTILS_H
+#define IRESEARCH_MICROBENCH_INDEX_UTILS_H
+
+#include "index/doc_generator.hpp"
+#include "index/directory_reader.hpp"
+#include "store/memory_directory.hpp"
+
+namespace microbench {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the field every synthetic document has a term in
+////////////////////////////////////////////////////////////////////////////////
+constexpr irs::string_ref BODY = "body";
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the field holding a unique term per document
+////////////////////////////////////////////////////////////////////////////////
+constexpr irs::string_ref ID = "id";
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief synthetic documents contain term 'step_term(step)' in field 'BODY'
+///        iff 'doc % step == 0', i.e. a posting list has density '1/step'
+////////////////////////////////////////////////////////////////////////////////
+constexpr size_t STEPS[] { 1, 2, 3, 4, 5, 7, 8, 11, 13, 16, 32, 64, 128, 256, 1024 };
+
+std::string step_term(size_t step);
+
+std::string id_term(size_t doc);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class synthetic_doc_generator
+/// @brief generates 'docs' documents as described by 'STEPS'
+////////////////////////////////////////////////////////////////////////////////
+class synthetic_doc_generator final : public tests::doc_generator_base {
+ public:
+  explicit synthetic_doc_generator(size_t docs);
+
+  virtual const tests::document* next() override;
+  virtual void reset() override { next_ = 1; }
+
+ private:
+  tests::document doc_;
+  size_t docs_;
+  size_t next_{1};
+}; // synthetic_doc_generator
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct index
+/// @brief in-memory index opened for reading
+////////////////////////////////////////////////////////////////////////////////
+struct index {
+  irs::memory_directory dir;
+  irs::directory_reader reader;
+}; // index
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns single segment index built from 'docs' synthetic documents
+/// @note indexes are built once per process and then cached
+////////////////////////////////////////////////////////////////////////////////
+const index& synthetic_index(size_t docs, irs::string_ref format = "1_4");
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns single segment index built from 'europarl.subset.txt' test
+///          resource with a whitespace tokenized field 'BODY'
+/// @note indexes are built once per process and then cached
+////////////////////////////////////////////////////////////////////////////////
+const index& europarl_index(irs::string_ref format = "1_4");
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns terms of the specified field in lexicographical order
+////////////////////////////////////////////////////////////////////////////////
+std::vector<irs::bstring> terms(const irs::sub_reader& segment,
+                                irs::string_ref field);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns postings of the specified term, empty iterator if not found
+////////////////////////////////////////////////////////////////////////////////
+irs::doc_iterator::ptr postings(const irs::sub_reader& segment,
+                                irs::string_ref field,
+                                irs::string_ref term,
+                                irs::IndexFeatures features = irs::IndexFeatures::NONE);
+
+}
+
+#endif // IRESEARCH_MICROBENCH_INDEX_UTILS_H
@@ -0,0 +1,253 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+#include "index_utils.hpp"
+#include "search/bm25.hpp"
+#include "search/boolean_filter.hpp"
+#include "search/conjunction.hpp"
+#include "search/disjunction.hpp"
+#include "search/score.hpp"
+#include "search/term_filter.hpp"
+#include "search/tfidf.hpp"
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                        parameters
+// -----------------------------------------------------------------------------
+
+constexpr int64_t DOCS[] { 1 << 16, 1 << 20 };
+
+// every entry is a set of posting list steps, i.e. '{ 2, 3 }' stands for
+// 2 lists of densities 1/2 and 1/3 respectively
+const std::vector<std::vector<int64_t>> STEP_SETS {
+  { 2, 3 },
+  { 2, 3, 5 },
+  { 1, 4, 16 },
+  { 16, 1024 },
+  { 2, 3, 5, 7, 11, 13 },
+  { 4, 8, 16, 32, 64, 128, 256, 1024 }
+};
+
+void docs_and_step_sets(benchmark::internal::Benchmark* b) {
+  for (auto docs : DOCS) {
+    for (size_t i = 0; i < STEP_SETS.size(); ++i) {
+      b->Args({docs, int64_t(i)});
+    }
+  }
+}
+
+template<typename Iterator>
+irs::doc_iterator::ptr make_compound(
+    const irs::sub_reader& segment,
+    const std::vector<int64_t>& steps) {
+  typename Iterator::doc_iterators_t itrs;
+  itrs.reserve(steps.size());
+
+  for (auto step : steps) {
+    itrs.emplace_back(microbench::postings(
+      segment, microbench::BODY, microbench::step_term(step)));
+  }
+
+  return irs::memory::make_managed<Iterator>(std::move(itrs));
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                        conjunction & disjunction
+// -----------------------------------------------------------------------------
+
+using conjunction = irs::conjunction<irs::doc_iterator::ptr>;
+using heap_disjunction = irs::disjunction<irs::doc_iterator::ptr>;
+using small_disjunction = irs::small_disjunction<irs::doc_iterator::ptr>;
+using block_disjunction = irs::disjunction_iterator<irs::doc_iterator::ptr>;
+
+// args: number of docs in a segment, index in 'STEP_SETS'
+template<typename Iterator>
+void BM_compound_next(benchmark::State& state) {
+  auto& segment = microbench::synthetic_index(state.range(0)).reader[0];
+  auto& steps = STEP_SETS[state.range(1)];
+
+  size_t docs = 0;
+  for (auto _ : state) {
+    for (auto it = make_compound<Iterator>(segment, steps); it->next();) {
+      benchmark::DoNotOptimize(it->value());
+      ++docs;
+    }
+  }
+
+  state.SetItemsProcessed(docs);
+}
+
+BENCHMARK_TEMPLATE(BM_compound_next, conjunction)->Apply(docs_and_step_sets);
+BENCHMARK_TEMPLATE(BM_compound_next, heap_disjunction)->Apply(docs_and_step_sets);
+BENCHMARK_TEMPLATE(BM_compound_next, small_disjunction)->Apply(docs_and_step_sets);
+BENCHMARK_TEMPLATE(BM_compound_next, block_disjunction)->Apply(docs_and_step_sets);
+
+// args: number of docs in a segment, index in 'STEP_SETS', distance between seeks
+template<typename Iterator>
+void BM_compound_seek(benchmark::State& state) {
+  auto& segment = microbench::synthetic_index(state.range(0)).reader[0];
+  auto& steps = STEP_SETS[state.range(1)];
+  const irs::doc_id_t skip = state.range(2);
+
+  size_t seeks = 0;
+  for (auto _ : state) {
+    auto it = make_compound<Iterator>(segment, steps);
+
+    for (irs::doc_id_t target = irs::doc_limits::min();
+         !irs::doc_limits::eof(it->seek(target));
+         target += skip) {
+      benchmark::DoNotOptimize(it->value());
+      ++seeks;
+    }
+  }
+
+  state.SetItemsProcessed(seeks);
+}
+
+void docs_step_sets_and_skips(benchmark::internal::Benchmark* b) {
+  for (auto docs : DOCS) {
+    for (size_t i = 0; i < STEP_SETS.size(); ++i) {
+      for (auto skip : { 64, 4096 }) {
+        b->Args({docs, int64_t(i), skip});
+      }
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_compound_seek, conjunction)->Apply(docs_step_sets_and_skips);
+BENCHMARK_TEMPLATE(BM_compound_seek, heap_disjunction)->Apply(docs_step_sets_and_skips);
+BENCHMARK_TEMPLATE(BM_compound_seek, block_disjunction)->Apply(docs_step_sets_and_skips);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                          scorers
+// -----------------------------------------------------------------------------
+
+template<typename Sort>
+irs::order::prepared prepare_order() {
+  irs::order ord;
+  ord.add<Sort>(true);
+  return ord.prepare();
+}
+
+size_t execute_scored(
+    const irs::filter::prepared& query,
+    const irs::sub_reader& segment,
+    const irs::order::prepared& ord) {
+  size_t docs = 0;
+
+  auto it = query.execute(segment, ord);
+  auto& score = irs::score::get(*it);
+
+  while (it->next()) {
+    benchmark::DoNotOptimize(score.evaluate());
+    ++docs;
+  }
+
+  return docs;
+}
+
+// args: number of docs in a segment, posting list step
+template<typename Sort>
+void BM_scored_term(benchmark::State& state) {
+  auto& index = microbench::synthetic_index(state.range(0));
+  const auto ord = prepare_order<Sort>();
+
+  irs::by_term filter;
+  *filter.mutable_field() = microbench::BODY;
+  filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(
+    irs::string_ref(microbench::step_term(state.range(1))));
+
+  auto query = filter.prepare(index.reader, ord);
+
+  size_t docs = 0;
+  for (auto _ : state) {
+    docs += execute_scored(*query, index.reader[0], ord);
+  }
+
+  state.SetItemsProcessed(docs);
+}
+
+void docs_and_steps(benchmark::internal::Benchmark* b) {
+  for (auto docs : DOCS) {
+    for (auto step : { 1, 16, 1024 }) {
+      b->Args({docs, step});
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_scored_term, irs::bm25_sort)->Apply(docs_and_steps);
+BENCHMARK_TEMPLATE(BM_scored_term, irs::tfidf_sort)->Apply(docs_and_steps);
+
+// args: number of docs in a segment, index in 'STEP_SETS'
+template<typename Sort, typename Filter>
+void BM_scored_boolean(benchmark::State& state) {
+  auto& index = microbench::synthetic_index(state.range(0));
+  const auto ord = prepare_order<Sort>();
+
+  Filter filter;
+  for (auto step : STEP_SETS[state.range(1)]) {
+    auto& sub = filter.template add<irs::by_term>();
+    *sub.mutable_field() = microbench::BODY;
+    sub.mutable_options()->term = irs::ref_cast<irs::byte_type>(
+      irs::string_ref(microbench::step_term(step)));
+  }
+
+  auto query = filter.prepare(index.reader, ord);
+
+  size_t docs = 0;
+  for (auto _ : state) {
+    docs += execute_scored(*query, index.reader[0], ord);
+  }
+
+  state.SetItemsProcessed(docs);
+}
+
+BENCHMARK_TEMPLATE(BM_scored_boolean, irs::bm25_sort, irs::And)->Apply(docs_and_step_sets);
+BENCHMARK_TEMPLATE(BM_scored_boolean, irs::bm25_sort, irs::Or)->Apply(docs_and_step_sets);
+BENCHMARK_TEMPLATE(BM_scored_boolean, irs::tfidf_sort, irs::And)->Apply(docs_and_step_sets);
+BENCHMARK_TEMPLATE(BM_scored_boolean, irs::tfidf_sort, irs::Or)->Apply(docs_and_step_sets);
+
+// args: index of a term in a dictionary sorted by document frequency
+template<typename Sort>
+void BM_scored_term_europarl(benchmark::State& state) {
+  auto& index = microbench::europarl_index();
+  auto& segment = index.reader[0];
+  const auto ord = prepare_order<Sort>();
+
+  // pick a term by its rank, 0 stands for the most frequent one
+  auto terms = microbench::terms(segment, microbench::BODY);
+  std::vector<std::pair<size_t, irs::bstring>> ranked;
+  ranked.reserve(terms.size());
+  for (auto& term : terms) {
+    size_t docs = 0;
+    for (auto it = microbench::postings(segment, microbench::BODY,
+                                        irs::ref_cast<char>(irs::bytes_ref(term)));
+         it->next();) {
+      ++docs;
+    }
+    ranked.emplace_back(docs, std::move(term));
+  }
+  std::sort(ranked.begin(), ranked.end(), std::greater<>());
+
+  const size_t rank = std::min(size_t(state.range(0)), ranked.size() - 1);
+
+  irs::by_term filter;
+  *filter.mutable_field() = microbench::BODY;
+  filter.mutable_options()->term = ranked[rank].second;
+
+  auto query = filter.prepare(index.reader, ord);
+
+  size_t docs = 0;
+  for (auto _ : state) {
+    docs += execute_scored(*query, segment, ord);
+  }
+
+  state.SetItemsProcessed(docs);
+}
+
+BENCHMARK_TEMPLATE(BM_scored_term_europarl, irs::bm25_sort)->Arg(0)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_scored_term_europarl, irs::tfidf_sort)->Arg(0)->Arg(10)->Arg(100);
+
+}
@@ -0,0 +1,177 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+#include "index_utils.hpp"
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                        parameters
+// -----------------------------------------------------------------------------
+
+constexpr int64_t DOCS[] { 1 << 16, 1 << 20 };
+constexpr int64_t DENSITY_STEPS[] { 1, 4, 16, 128, 1024 };
+
+void docs_and_steps(benchmark::internal::Benchmark* b) {
+  for (auto docs : DOCS) {
+    for (auto step : DENSITY_STEPS) {
+      b->Args({docs, step});
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                           postings decode & seek
+// -----------------------------------------------------------------------------
+
+// args: number of docs in a segment, posting list step
+void BM_postings_next(benchmark::State& state, irs::IndexFeatures features) {
+  auto& index = microbench::synthetic_index(state.range(0));
+  auto& segment = index.reader[0];
+  const auto term = microbench::step_term(state.range(1));
+
+  size_t docs = 0;
+  for (auto _ : state) {
+    for (auto it = microbench::postings(segment, microbench::BODY, term, features); it->next();) {
+      benchmark::DoNotOptimize(it->value());
+      ++docs;
+    }
+  }
+
+  state.SetItemsProcessed(docs);
+}
+
+BENCHMARK_CAPTURE(BM_postings_next, docs, irs::IndexFeatures::NONE)->Apply(docs_and_steps);
+BENCHMARK_CAPTURE(BM_postings_next, freq, irs::IndexFeatures::FREQ)->Apply(docs_and_steps);
+
+// args: number of docs in a segment, posting list step, distance between seeks
+void BM_postings_seek(benchmark::State& state) {
+  auto& index = microbench::synthetic_index(state.range(0));
+  auto& segment = index.reader[0];
+  const auto term = microbench::step_term(state.range(1));
+  const irs::doc_id_t skip = state.range(2);
+
+  size_t seeks = 0;
+  for (auto _ : state) {
+    auto it = microbench::postings(segment, microbench::BODY, term);
+
+    for (irs::doc_id_t target = irs::doc_limits::min();
+         !irs::doc_limits::eof(it->seek(target));
+         target += skip) {
+      benchmark::DoNotOptimize(it->value());
+      ++seeks;
+    }
+  }
+
+  state.SetItemsProcessed(seeks);
+}
+
+BENCHMARK(BM_postings_seek)->Apply([](benchmark::internal::Benchmark* b) {
+  for (auto docs : DOCS) {
+    for (auto step : { 1, 16, 128 }) {
+      for (auto skip : { 2, 64, 1024, 65536 }) {
+        b->Args({docs, step, skip});
+      }
+    }
+  }
+});
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 term dictionary
+// -----------------------------------------------------------------------------
+
+std::vector<irs::bstring> shuffled_terms(
+    const irs::sub_reader& segment,
+    irs::string_ref field) {
+  auto terms = microbench::terms(segment, field);
+  std::shuffle(terms.begin(), terms.end(), std::mt19937_64{42});
+  return terms;
+}
+
+void seek_terms(
+    benchmark::State& state,
+    const irs::term_reader& field,
+    const std::vector<irs::bstring>& terms,
+    irs::SeekMode mode) {
+  size_t seeks = 0;
+  for (auto _ : state) {
+    auto it = field.iterator(mode);
+
+    for (auto& term : terms) {
+      benchmark::DoNotOptimize(it->seek(term));
+      ++seeks;
+    }
+  }
+
+  state.SetItemsProcessed(seeks);
+}
+
+// args: number of docs in a segment
+void BM_term_seek_synthetic(benchmark::State& state, irs::SeekMode mode) {
+  auto& segment = microbench::synthetic_index(state.range(0)).reader[0];
+  const auto terms = shuffled_terms(segment, microbench::ID);
+  auto* field = segment.field(microbench::ID);
+
+  if (!field) {
+    state.SkipWithError("missing field");
+    return;
+  }
+
+  seek_terms(state, *field, terms, mode);
+}
+
+BENCHMARK_CAPTURE(BM_term_seek_synthetic, normal, irs::SeekMode::NORMAL)
+  ->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_term_seek_synthetic, random_only, irs::SeekMode::RANDOM_ONLY)
+  ->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_term_seek_europarl(benchmark::State& state, irs::SeekMode mode) {
+  auto& segment = microbench::europarl_index().reader[0];
+  const auto terms = shuffled_terms(segment, microbench::BODY);
+  auto* field = segment.field(microbench::BODY);
+
+  if (!field) {
+    state.SkipWithError("missing field");
+    return;
+  }
+
+  seek_terms(state, *field, terms, mode);
+}
+
+BENCHMARK_CAPTURE(BM_term_seek_europarl, normal, irs::SeekMode::NORMAL);
+BENCHMARK_CAPTURE(BM_term_seek_europarl, random_only, irs::SeekMode::RANDOM_ONLY);
+
+// args: number of docs in a segment
+void BM_term_seek_ge_missing(benchmark::State& state) {
+  auto& segment = microbench::synthetic_index(state.range(0)).reader[0];
+  auto* field = segment.field(microbench::ID);
+
+  if (!field) {
+    state.SkipWithError("missing field");
+    return;
+  }
+
+  // every term is located between 2 adjacent terms of the dictionary
+  auto terms = shuffled_terms(segment, microbench::ID);
+  for (auto& term : terms) {
+    term.push_back('0');
+  }
+
+  size_t seeks = 0;
+  for (auto _ : state) {
+    auto it = field->iterator(irs::SeekMode::NORMAL);
+
+    for (auto& term : terms) {
+      benchmark::DoNotOptimize(it->seek_ge(term));
+      ++seeks;
+    }
+  }
+
+  state.SetItemsProcessed(seeks);
+}
+
+BENCHMARK(BM_term_seek_ge_missing)->Arg(1 << 16)->Arg(1 << 20);
+
+}
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "analysis/delimited_token_stream.hpp"
+#include "analysis/pre_analyzed_token_stream.hpp"
+
+namespace {
+
+struct token {
+  std::string term;
+  uint32_t inc;
+  uint32_t start;
+  uint32_t end;
+
+  bool operator==(const token& rhs) const noexcept {
+    return term == rhs.term && inc == rhs.inc
+      && start == rhs.start && end == rhs.end;
+  }
+};
+
+std::vector<token> tokens(irs::token_stream& stream) {
+  auto* term = irs::get<irs::term_attribute>(stream);
+  auto* inc = irs::get<irs::increment>(stream);
+  auto* offs = irs::get<irs::offset>(stream);
+  EXPECT_NE(nullptr, term);
+  EXPECT_NE(nullptr, inc);
+  EXPECT_NE(nullptr, offs);
+
+  std::vector<token> result;
+  while (stream.next()) {
+    const auto value = irs::ref_cast<char>(term->value);
+    result.push_back({
+      std::string(value.c_str(), value.size()),
+      inc->value, offs->start, offs->end });
+  }
+  return result;
+}
+
+irs::bstring record(irs::analysis::pre_analyzed_token_stream::recorder& recorder,
+                    irs::string_ref value,
+                    std::vector<token>& expected) {
+  EXPECT_TRUE(recorder.reset(value));
+  expected = tokens(recorder);
+  return recorder.data();
+}
+
+}
+
+TEST(pre_analyzed_token_stream_tests, consts) {
+  static_assert("pre_analyzed" == irs::type<irs::analysis::pre_analyzed_token_stream>::name());
+}
+
+TEST(pre_analyzed_token_stream_tests, round_trip) {
+  irs::analysis::pre_analyzed_token_stream::recorder recorder(
+    irs::analysis::delimited_token_stream::make(","));
+  irs::analysis::pre_analyzed_token_stream stream;
+
+  // recorder passes tokens of a wrapped analyzer through
+  {
+    std::vector<token> expected;
+    const auto data = record(recorder, "quick,brown,,fox", expected);
+    ASSERT_EQ(4, expected.size());
+    ASSERT_EQ((token{ "brown", 1, 6, 11 }), expected[1]);
+    ASSERT_EQ(irs::analysis::pre_analyzed_token_stream::FORMAT_VERSION, data[0]);
+
+    ASSERT_TRUE(stream.reset(data));
+    ASSERT_EQ(expected, tokens(stream));
+    ASSERT_FALSE(stream.next());
+
+    // replay once again
+    ASSERT_TRUE(stream.reset(irs::ref_cast<char>(irs::bytes_ref(data))));
+    ASSERT_EQ(expected, tokens(stream));
+  }
+
+  // long terms and offsets
+  {
+    const std::string value = std::string(300, 'a') + "," + std::string(70000, 'b');
+    std::vector<token> expected;
+    const auto data = record(recorder, value, expected);
+    ASSERT_EQ(2, expected.size());
+    ASSERT_EQ(70000, expected[1].term.size());
+
+    ASSERT_TRUE(stream.reset(data));
+    ASSERT_EQ(expected, tokens(stream));
+  }
+
+  // empty value
+  {
+    std::vector<token> expected;
+    const auto data = record(recorder, "", expected);
+    ASSERT_TRUE(stream.reset(data));
+    ASSERT_EQ(expected, tokens(stream));
+  }
+}
+
+TEST(pre_analyzed_token_stream_tests, malformed) {
+  irs::analysis::pre_analyzed_token_stream::recorder recorder(
+    irs::analysis::delimited_token_stream::make(","));
+  irs::analysis::pre_analyzed_token_stream stream;
+  auto* err = irs::get<irs::stream_error>(stream);
+  ASSERT_NE(nullptr, err);
+
+  // not in the pre-analyzed format
+  ASSERT_FALSE(stream.reset(irs::bytes_ref::EMPTY));
+  ASSERT_TRUE(err->value);
+  ASSERT_FALSE(stream.next());
+  ASSERT_FALSE(stream.reset(irs::string_ref("\x7Fquick")));
+  ASSERT_TRUE(err->value);
+  ASSERT_FALSE(stream.next());
+
+  std::vector<token> expected;
+  const auto first = record(recorder, "quick", expected);
+  const auto data = record(recorder, "quick,brown", expected);
+  ASSERT_EQ(2, expected.size());
+
+  // truncated input terminates the stream after the last complete token,
+  // the error is reported unless the input ends at a token boundary
+  for (size_t size = 1; size < data.size(); ++size) {
+    ASSERT_TRUE(stream.reset(irs::bytes_ref(data.c_str(), size)));
+    ASSERT_FALSE(err->value);
+    const auto actual = tokens(stream);
+    ASSERT_LT(actual.size(), expected.size());
+    ASSERT_TRUE(std::equal(actual.begin(), actual.end(), expected.begin()));
+    ASSERT_FALSE(stream.next());
+    ASSERT_EQ(size != 1 && size != first.size(), err->value);
+  }
+
+  // complete input
+  ASSERT_TRUE(stream.reset(data));
+  ASSERT_EQ(expected, tokens(stream));
+  ASSERT_FALSE(err->value);
+
+  // unterminated vint
+  const irs::byte_type invalid[] { 0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+  ASSERT_TRUE(stream.reset(irs::bytes_ref(invalid, sizeof invalid)));
+  ASSERT_FALSE(stream.next());
+  ASSERT_TRUE(err->value);
+}
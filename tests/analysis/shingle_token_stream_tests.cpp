@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "tests_shared.hpp"
+#include "analysis/shingle_token_stream.hpp"
+
+namespace {
+
+// emits a predefined sequence of terms along with position increments
+class tokens_stream final : public irs::token_stream {
+ public:
+  explicit tokens_stream(std::vector<std::pair<std::string, uint32_t>> tokens)
+    : tokens_(std::move(tokens)) {
+  }
+
+  virtual bool next() override {
+    if (next_ == tokens_.size()) {
+      return false;
+    }
+
+    auto& token = tokens_[next_++];
+    std::get<irs::term_attribute>(attrs_).value =
+      irs::ref_cast<irs::byte_type>(irs::string_ref(token.first));
+    std::get<irs::increment>(attrs_).value = token.second;
+    return true;
+  }
+
+  virtual irs::attribute* get_mutable(irs::type_info::type_id type) override {
+    return irs::get_mutable(attrs_, type);
+  }
+
+ private:
+  std::tuple<irs::increment, irs::term_attribute> attrs_;
+  std::vector<std::pair<std::string, uint32_t>> tokens_;
+  size_t next_{};
+}; // tokens_stream
+
+irs::bstring shingle(irs::string_ref lhs, irs::string_ref rhs) {
+  return irs::make_shingle(irs::ref_cast<irs::byte_type>(lhs),
+                           irs::ref_cast<irs::byte_type>(rhs));
+}
+
+// pairs of expected shingles and their positions
+using shingles_t = std::vector<std::pair<irs::bstring, uint32_t>>;
+
+void assert_shingles(
+    std::vector<std::pair<std::string, uint32_t>> tokens,
+    const shingles_t& expected) {
+  tokens_stream input(std::move(tokens));
+  irs::shingle_token_stream shingles;
+  shingles.reset();
+
+  // recorder passes tokens through
+  {
+    irs::shingle_token_stream::recorder recorder(input, shingles);
+    auto* term = irs::get<irs::term_attribute>(recorder);
+    ASSERT_EQ(irs::get<irs::term_attribute>(input), term);
+    while (recorder.next()) { }
+  }
+
+  auto* term = irs::get<irs::term_attribute>(shingles);
+  ASSERT_NE(nullptr, term);
+  auto* inc = irs::get<irs::increment>(shingles);
+  ASSERT_NE(nullptr, inc);
+
+  uint32_t pos = 0;
+  auto it = expected.begin();
+  for (; shingles.next(); ++it) {
+    ASSERT_NE(expected.end(), it);
+    pos += inc->value;
+    ASSERT_EQ(it->first, term->value);
+    ASSERT_EQ(it->second, pos);
+  }
+  ASSERT_EQ(expected.end(), it);
+}
+
+}
+
+TEST(shingle_token_stream_tests, make_shingle) {
+  // term boundary is a part of a shingle
+  ASSERT_NE(shingle("ab", "c"), shingle("a", "bc"));
+  ASSERT_EQ(shingle("ab", "c"), shingle("ab", "c"));
+  ASSERT_NE(shingle("a", "b"), shingle("b", "a"));
+  ASSERT_EQ(3, shingle("a", "b").size());
+  ASSERT_EQ(1, shingle("", "").size());
+
+  ASSERT_NE(irs::shingle_field("text"), "text");
+  ASSERT_EQ(irs::shingle_field("text"), irs::shingle_field("text"));
+  ASSERT_NE(irs::shingle_field("text"), irs::shingle_field("text1"));
+}
+
+TEST(shingle_token_stream_tests, empty) {
+  assert_shingles({}, {});
+  assert_shingles({ { "quick", 1 } }, {});
+}
+
+TEST(shingle_token_stream_tests, sequential) {
+  assert_shingles(
+    { { "quick", 1 }, { "brown", 1 }, { "fox", 1 } },
+    { { shingle("quick", "brown"), 1 },
+      { shingle("brown", "fox"), 2 } });
+}
+
+TEST(shingle_token_stream_tests, gaps) {
+  // no shingles across a gap, e.g. a removed stopword
+  assert_shingles(
+    { { "quick", 1 }, { "brown", 1 }, { "fox", 2 }, { "jumps", 1 } },
+    { { shingle("quick", "brown"), 1 },
+      { shingle("fox", "jumps"), 4 } });
+}
+
+TEST(shingle_token_stream_tests, overlapping_tokens) {
+  // every token at a position is paired with every token at the next one
+  assert_shingles(
+    { { "quick", 1 }, { "fast", 0 }, { "brown", 1 }, { "fox", 1 }, { "dog", 0 } },
+    { { shingle("quick", "brown"), 1 },
+      { shingle("fast", "brown"), 1 },
+      { shingle("brown", "fox"), 2 },
+      { shingle("brown", "dog"), 2 } });
+}
+
+TEST(shingle_token_stream_tests, reset) {
+  tokens_stream input({ { "quick", 1 }, { "brown", 1 } });
+  irs::shingle_token_stream shingles;
+
+  irs::shingle_token_stream::recorder recorder(input, shingles);
+  while (recorder.next()) { }
+
+  shingles.reset();
+  ASSERT_FALSE(shingles.next());
+}
+
+TEST(shingle_token_stream_tests, instances) {
+  irs::shingle_token_stream shingles;
+  auto* term = irs::get<irs::term_attribute>(shingles);
+  ASSERT_NE(nullptr, term);
+  auto* inc = irs::get<irs::increment>(shingles);
+  ASSERT_NE(nullptr, inc);
+
+  // tokens of the next instance continue positions of the previous one
+  const std::vector<std::vector<std::pair<std::string, uint32_t>>> instances {
+    { { "quick", 1 }, { "brown", 1 } },
+    { { "fox", 1 }, { "jumps", 1 } },
+    { },
+    { { "over", 1 }, { "dog", 2 } }
+  };
+
+  const shingles_t expected {
+    { shingle("quick", "brown"), 1 },
+    { shingle("brown", "fox"), 2 },
+    { shingle("fox", "jumps"), 3 },
+    { shingle("jumps", "over"), 4 }
+  };
+
+  uint32_t pos = 0;
+  auto it = expected.begin();
+  for (auto& tokens : instances) {
+    tokens_stream input(tokens);
+    irs::shingle_token_stream::recorder recorder(input, shingles);
+    while (recorder.next()) { }
+
+    for (; shingles.next(); ++it) {
+      ASSERT_NE(expected.end(), it);
+      pos += inc->value;
+      ASSERT_EQ(it->first, term->value);
+      ASSERT_EQ(it->second, pos);
+    }
+  }
+  ASSERT_EQ(expected.end(), it);
+
+  // positions start over
+  shingles.reset();
+  {
+    tokens_stream input({ { "lazy", 1 } });
+    irs::shingle_token_stream::recorder recorder(input, shingles);
+    while (recorder.next()) { }
+  }
+  ASSERT_FALSE(shingles.next());
+}
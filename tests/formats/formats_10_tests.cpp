@@ -285,6 +285,56 @@ class format_10_test_case : public tests::format_test_case {
           }
         }
 
+        // bulk read with a buffer not aligned to the block size
+        {
+          auto it = reader->iterator(field.index_features, features, read_meta);
+          ASSERT_FALSE(irs::doc_limits::valid(it->value()));
+          auto* freq = irs::get<irs::frequency>(*it);
+
+          postings expected(docs.begin(), docs.end(), field.index_features);
+          irs::doc_id_t buf[50];
+          uint32_t freqs[50];
+          size_t read;
+          do {
+            read = it->next_batch(buf, freqs, IRESEARCH_COUNTOF(buf));
+            for (size_t i = 0; i < read; ++i) {
+              ASSERT_TRUE(expected.next());
+              ASSERT_EQ(expected.value(), buf[i]);
+              if (freq) {
+                ASSERT_EQ(irs::get<irs::frequency>(expected)->value, freqs[i]);
+              }
+            }
+            if (read) {
+              ASSERT_EQ(buf[read - 1], it->value());
+              assert_positions(expected, *it);
+            }
+          } while (read == IRESEARCH_COUNTOF(buf));
+          ASSERT_FALSE(expected.next());
+          ASSERT_TRUE(irs::doc_limits::eof(it->value()));
+          ASSERT_EQ(0, it->next_batch(buf, nullptr, IRESEARCH_COUNTOF(buf)));
+        }
+
+        // mix of seek, next and bulk read
+        {
+          auto it = reader->iterator(field.index_features, features, read_meta);
+          postings expected(docs.begin(), docs.end(), field.index_features);
+          const auto target = docs[docs.size() / 2];
+          ASSERT_EQ(target, it->seek(target));
+          ASSERT_EQ(target, expected.seek(target));
+
+          irs::doc_id_t buf[3];
+          const size_t read = it->next_batch(buf, nullptr, IRESEARCH_COUNTOF(buf));
+          for (size_t i = 0; i < read; ++i) {
+            ASSERT_TRUE(expected.next());
+            ASSERT_EQ(expected.value(), buf[i]);
+          }
+          if (read) {
+            assert_positions(expected, *it);
+          }
+          ASSERT_EQ(expected.next(), it->next());
+          ASSERT_EQ(expected.value(), it->value());
+        }
+
         // seek for INVALID_DOC
         {
           auto it = reader->iterator(field.index_features, irs::IndexFeatures::NONE, read_meta);
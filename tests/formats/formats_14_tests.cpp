@@ -19,10 +19,209 @@
 
 #include "tests_shared.hpp"
 #include "formats_test_case_base.hpp"
+#include "formats/formats_burst_trie.hpp"
 #include "store/directory_attributes.hpp"
+#include "utils/bloom_filter.hpp"
+#include "utils/index_utils.hpp"
 
 namespace {
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                          format 14 specific tests
+// -----------------------------------------------------------------------------
+
+class format_14_test_case : public tests::directory_test_case_base<> {
+ protected:
+  static std::vector<irs::bstring> terms(const irs::term_reader& field) {
+    std::vector<irs::bstring> terms;
+    for (auto it = field.iterator(irs::SeekMode::NORMAL); it->next(); ) {
+      terms.emplace_back(it->value());
+    }
+    return terms;
+  }
+};
+
+TEST_P(format_14_test_case, lazy_term_index) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  auto codec = irs::formats::get("1_4", "1_0");
+  ASSERT_NE(nullptr, codec);
+
+  {
+    auto writer = irs::index_writer::make(dir(), codec, irs::OM_CREATE);
+    ASSERT_NE(nullptr, writer);
+
+    for (const tests::document* doc; (doc = gen.next()); ) {
+      ASSERT_TRUE(insert(*writer,
+        doc->indexed.begin(), doc->indexed.end(),
+        doc->stored.begin(), doc->stored.end()));
+    }
+
+    writer->commit();
+  }
+
+  // term index is loaded eagerly by default
+  std::map<std::string, std::vector<irs::bstring>> expected;
+  {
+    auto reader = irs::directory_reader::open(dir(), codec);
+    ASSERT_EQ(1, reader.size());
+
+    for (auto fields = reader[0].fields(); fields->next(); ) {
+      auto& field = fields->value();
+      expected.emplace(field.meta().name, terms(field));
+    }
+  }
+  ASSERT_LT(1, expected.size());
+
+  // budget fits a single term index only
+  auto& cache = dir().attributes().emplace<irs::burst_trie::term_index_cache>(1);
+  ASSERT_NE(nullptr, cache);
+  ASSERT_EQ(1, cache->memory_limit());
+
+  const bool lazy = !dir().attributes().contains<tests::rot13_encryption>();
+
+  {
+    auto reader = irs::directory_reader::open(dir(), codec);
+    ASSERT_EQ(1, reader.size());
+    auto& segment = reader[0];
+    ASSERT_EQ(0, cache->memory_used());
+
+    auto& first = expected.begin()->first;
+    auto* field = segment.field(first);
+    ASSERT_NE(nullptr, field);
+
+    // iterator keeps its term index alive
+    auto it = field->iterator(irs::SeekMode::NORMAL);
+    ASSERT_TRUE(it->next());
+    ASSERT_EQ(lazy, 0 != cache->memory_used());
+
+    // evicts previously loaded term indexes
+    for (auto& entry : expected) {
+      auto* field = segment.field(entry.first);
+      ASSERT_NE(nullptr, field);
+      ASSERT_EQ(entry.second, terms(*field));
+      ASSERT_EQ(entry.second, terms(*field)); // reloaded if evicted
+    }
+
+    std::vector<irs::bstring> actual;
+    do {
+      actual.emplace_back(it->value());
+    } while (it->next());
+    ASSERT_EQ(expected.begin()->second, actual);
+
+    // random access
+    for (auto& entry : expected) {
+      auto* field = segment.field(entry.first);
+      ASSERT_NE(nullptr, field);
+      auto it = field->iterator(irs::SeekMode::RANDOM_ONLY);
+
+      for (auto& term : entry.second) {
+        ASSERT_TRUE(it->seek(term));
+      }
+    }
+  }
+
+  // all term indexes are released along with the reader
+  ASSERT_EQ(0, cache->memory_used());
+}
+
+TEST_P(format_14_test_case, term_bloom_filter) {
+  constexpr size_t NUM_DOCS = 100;
+  const std::vector<irs::type_info::type_id> features{
+    irs::type<irs::term_bloom_filter>::id() };
+
+  auto codec = irs::formats::get("1_4", "1_0");
+  ASSERT_NE(nullptr, codec);
+
+  irs::index_writer::init_options opts;
+  opts.features.emplace(irs::type<irs::term_bloom_filter>::id(), nullptr);
+
+  auto writer = irs::index_writer::make(dir(), codec, irs::OM_CREATE, opts);
+  ASSERT_NE(nullptr, writer);
+
+  // even ids only, split into 2 segments
+  for (size_t i = 0; i < NUM_DOCS; i += 2) {
+    tests::templates::string_field id("id", std::to_string(i), irs::IndexFeatures::NONE, features);
+    tests::templates::string_field name("name", std::to_string(i));
+
+    {
+      auto ctx = writer->documents();
+      auto doc = ctx.insert();
+      ASSERT_TRUE(doc.insert<irs::Action::INDEX>(id));
+      ASSERT_TRUE(doc.insert<irs::Action::INDEX>(name));
+    }
+
+    if (i == NUM_DOCS / 2) {
+      writer->commit();
+    }
+  }
+  writer->commit();
+
+  auto assert_segment = [&](const irs::sub_reader& segment) {
+    auto* id = segment.field("id");
+    ASSERT_NE(nullptr, id);
+    ASSERT_EQ(1, id->meta().features.count(irs::type<irs::term_bloom_filter>::id()));
+
+    auto* name = segment.field("name");
+    ASSERT_NE(nullptr, name);
+    ASSERT_EQ(0, name->meta().features.count(irs::type<irs::term_bloom_filter>::id()));
+
+    // all present terms are found, absent ones are rejected
+    for (auto* field : { id, name }) {
+      size_t found = 0;
+
+      for (size_t i = 0; i < NUM_DOCS; ++i) {
+        const auto term = std::to_string(i);
+        auto it = field->iterator(irs::SeekMode::RANDOM_ONLY);
+        ASSERT_NE(nullptr, it);
+
+        if (it->seek(irs::ref_cast<irs::byte_type>(irs::string_ref(term)))) {
+          ASSERT_EQ(0, i % 2);
+          ASSERT_EQ(irs::ref_cast<irs::byte_type>(irs::string_ref(term)), it->value());
+          ++found;
+        }
+      }
+
+      ASSERT_EQ(field->size(), found);
+    }
+  };
+
+  {
+    auto reader = irs::directory_reader::open(dir(), codec);
+    ASSERT_EQ(2, reader.size());
+
+    for (auto& segment : reader) {
+      assert_segment(segment);
+    }
+  }
+
+  // bloom filter is rebuilt on merge
+  ASSERT_TRUE(writer->consolidate(
+    irs::index_utils::consolidation_policy(irs::index_utils::consolidate_count())));
+  writer->commit();
+
+  {
+    auto reader = irs::directory_reader::open(dir(), codec);
+    ASSERT_EQ(1, reader.size());
+    ASSERT_EQ(NUM_DOCS / 2, reader[0].docs_count());
+    assert_segment(reader[0]);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  format_14_test,
+  format_14_test_case,
+  ::testing::Values(
+    &tests::memory_directory,
+    &tests::fs_directory,
+    &tests::mmap_directory,
+    &tests::rot13_cipher_directory<&tests::mmap_directory, 16>
+  ),
+  tests::directory_test_case_base<>::to_string
+);
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                     generic tests
 // -----------------------------------------------------------------------------
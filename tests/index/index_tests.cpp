@@ -27,9 +27,13 @@
 
 #include "tests_shared.hpp" 
 #include "iql/query_builder.hpp"
+#include "analysis/delimited_token_stream.hpp"
+#include "analysis/pre_analyzed_token_stream.hpp"
 #include "index/field_meta.hpp"
+#include "index/index_snapshot.hpp"
 #include "index/norm.hpp"
 #include "index/field_meta.hpp"
+#include "search/term_filter.hpp"
 #include "store/memory_directory.hpp"
 #include "utils/index_utils.hpp"
 #include "utils/lz4compression.hpp"
@@ -5943,6 +5947,181 @@ TEST_P(index_test_case, import_reader) {
   }
 }
 
+TEST_P(index_test_case, import_segments) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    [] (tests::document& doc, const std::string& name, const tests::json_doc_generator::json_value& data) {
+    if (data.is_string()) {
+      doc.insert(std::make_shared<tests::templates::string_field>(name, data.str));
+    }
+  });
+
+  tests::document const* doc1 = gen.next();
+  tests::document const* doc2 = gen.next();
+  tests::document const* doc3 = gen.next();
+
+  // source index of 2 segments, 1 document is removed
+  irs::memory_directory data_dir;
+  {
+    auto data_writer = irs::index_writer::make(data_dir, codec(), irs::OM_CREATE);
+    ASSERT_TRUE(insert(*data_writer,
+      doc1->indexed.begin(), doc1->indexed.end(),
+      doc1->stored.begin(), doc1->stored.end()));
+    ASSERT_TRUE(insert(*data_writer,
+      doc2->indexed.begin(), doc2->indexed.end(),
+      doc2->stored.begin(), doc2->stored.end()));
+    data_writer->commit();
+    ASSERT_TRUE(insert(*data_writer,
+      doc3->indexed.begin(), doc3->indexed.end(),
+      doc3->stored.begin(), doc3->stored.end()));
+    data_writer->commit();
+
+    auto query_doc1 = irs::iql::query_builder().build("name==A", std::locale::classic());
+    data_writer->documents().remove(std::move(query_doc1.filter));
+    data_writer->commit();
+  }
+
+  auto data_reader = irs::directory_reader::open(data_dir, codec());
+  ASSERT_EQ(2, data_reader.size());
+  ASSERT_EQ(3, data_reader.docs_count());
+  ASSERT_EQ(2, data_reader.live_docs_count());
+
+  auto writer = open_writer();
+  ASSERT_TRUE(insert(*writer,
+    doc1->indexed.begin(), doc1->indexed.end(),
+    doc1->stored.begin(), doc1->stored.end()));
+  writer->commit();
+
+  // aborted import
+  ASSERT_FALSE(writer->import(data_dir, data_reader, []() { return false; }));
+  writer->commit();
+  ASSERT_EQ(1, irs::directory_reader::open(dir(), codec()).size());
+
+  ASSERT_TRUE(writer->import(data_dir, data_reader));
+  writer->commit();
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(3, reader.live_docs_count());
+
+  if (irs::get_encryption(dir().attributes())) {
+    // encrypted files can't be copied, segments are merged instead
+    ASSERT_EQ(2, reader.size());
+    ASSERT_EQ(3, reader.docs_count());
+  } else {
+    // segments are copied as is along with document masks
+    ASSERT_EQ(3, reader.size());
+    ASSERT_EQ(4, reader.docs_count());
+
+    auto& meta = reader.meta().meta;
+    std::unordered_set<std::string> names;
+    for (auto& segment : meta) {
+      ASSERT_TRUE(names.emplace(segment.meta.name).second);
+
+      for (auto& file : segment.meta.files) {
+        ASSERT_EQ(0, file.compare(0, segment.meta.name.size(), segment.meta.name));
+      }
+    }
+
+    ASSERT_EQ(2, reader[1].docs_count());
+    ASSERT_EQ(1, reader[1].live_docs_count());
+    ASSERT_EQ(1, reader[2].docs_count());
+  }
+
+  // imported documents are searchable
+  std::unordered_set<irs::string_ref> expected_names{ "A", "B", "C" };
+  for (auto& segment : reader) {
+    auto* column = segment.column_reader("name");
+    ASSERT_NE(nullptr, column);
+    auto values = column->values();
+    irs::bytes_ref actual_value;
+
+    for (auto docs = segment.docs_iterator(); docs->next();) {
+      ASSERT_TRUE(values(docs->value(), actual_value));
+      expected_names.erase(irs::to_string<irs::string_ref>(actual_value.c_str()));
+    }
+  }
+  ASSERT_TRUE(expected_names.empty());
+}
+
+TEST_P(index_test_case, snapshot) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    [] (tests::document& doc, const std::string& name, const tests::json_doc_generator::json_value& data) {
+    if (data.is_string()) {
+      doc.insert(std::make_shared<tests::templates::string_field>(name, data.str));
+    }
+  });
+
+  tests::document const* doc1 = gen.next();
+  tests::document const* doc2 = gen.next();
+
+  // no index committed yet
+  ASSERT_THROW(irs::index_snapshot::open(dir(), codec()), irs::index_not_found);
+
+  auto writer = open_writer();
+  ASSERT_TRUE(insert(*writer,
+    doc1->indexed.begin(), doc1->indexed.end(),
+    doc1->stored.begin(), doc1->stored.end()));
+  writer->commit();
+
+  // full backup
+  irs::memory_directory backup;
+  auto snapshot1 = irs::index_snapshot::open(dir(), codec());
+  ASSERT_TRUE(bool(snapshot1));
+  ASSERT_EQ(1, snapshot1.meta().size());
+  ASSERT_TRUE(std::is_sorted(snapshot1.files().begin(), snapshot1.files().end()));
+  ASSERT_TRUE(std::binary_search(snapshot1.files().begin(), snapshot1.files().end(),
+                                 snapshot1.filename()));
+  ASSERT_EQ(snapshot1.files(), snapshot1.changed(irs::index_snapshot()));
+  ASSERT_TRUE(snapshot1.copy(backup, snapshot1.files()));
+
+  // only files of a snapshot may be copied
+  ASSERT_FALSE(snapshot1.copy(backup, { "missing" }));
+
+  // incremental backup
+  ASSERT_TRUE(insert(*writer,
+    doc2->indexed.begin(), doc2->indexed.end(),
+    doc2->stored.begin(), doc2->stored.end()));
+  writer->commit();
+
+  auto snapshot2 = irs::index_snapshot::open(dir(), codec());
+  ASSERT_EQ(2, snapshot2.meta().size());
+  ASSERT_TRUE(snapshot2.changed(snapshot2).empty());
+  const auto changed = snapshot2.changed(snapshot1);
+  ASSERT_FALSE(changed.empty());
+  ASSERT_TRUE(std::binary_search(changed.begin(), changed.end(), snapshot2.filename()));
+  for (auto& file : changed) {
+    ASSERT_FALSE(std::binary_search(snapshot1.files().begin(), snapshot1.files().end(), file));
+  }
+  ASSERT_TRUE(snapshot2.copy(backup, changed));
+
+  // files of a snapshot are protected from removal
+  auto query_doc1 = irs::iql::query_builder().build("name==A", std::locale::classic());
+  writer->documents().remove(std::move(query_doc1.filter));
+  writer->commit();
+  ASSERT_EQ(1, irs::directory_reader::open(dir(), codec()).size());
+  irs::directory_cleaner::clean(dir());
+
+  for (auto& file : snapshot1.files()) {
+    bool exists;
+    ASSERT_TRUE(dir().exists(exists, file));
+    ASSERT_TRUE(exists);
+  }
+
+  for (auto& file : snapshot2.files()) {
+    bool exists;
+    ASSERT_TRUE(backup.exists(exists, file));
+    ASSERT_TRUE(exists);
+  }
+
+  // encrypted files are readable only via a directory having the same cipher
+  if (!irs::get_encryption(dir().attributes())) {
+    auto reader = irs::directory_reader::open(backup, codec());
+    ASSERT_EQ(2, reader.size());
+    ASSERT_EQ(2, reader.live_docs_count());
+  }
+}
+
 TEST_P(index_test_case, refresh_reader) {
   tests::json_doc_generator gen(
     resource("simple_sequential.json"),
@@ -13831,6 +14010,659 @@ TEST_P(index_test_case, ensure_no_empty_norms_written) {
   }
 }
 
+TEST_P(index_test_case, lookup_primary_keys) {
+  auto key_filter = [](const irs::string_ref& key) {
+    auto filter = irs::memory::make_unique<irs::by_term>();
+    *filter->mutable_field() = "id";
+    filter->mutable_options()->term = irs::ref_cast<irs::byte_type>(key);
+    return filter;
+  };
+
+  auto insert_doc = [](irs::index_writer::documents_context::document&& doc,
+                       const std::string& key, const std::string& value) {
+    tests::templates::string_field id("id", key);
+    tests::templates::string_field stored("value", value);
+    ASSERT_TRUE(doc.insert<irs::Action::INDEX>(id));
+    ASSERT_TRUE(doc.insert<irs::Action::STORE>(stored));
+  };
+
+  auto writer = open_writer();
+  ASSERT_NE(nullptr, writer);
+
+  // segment 0
+  {
+    auto ctx = writer->documents();
+    insert_doc(ctx.insert(), "A", "A0");
+    insert_doc(ctx.insert(), "B", "B0");
+    insert_doc(ctx.insert(), "C", "C0");
+  }
+  writer->commit();
+
+  // segment 1
+  {
+    auto ctx = writer->documents();
+    insert_doc(ctx.insert(), "D", "D1");
+    insert_doc(ctx.replace(*key_filter("B")), "B", "B1");
+    ctx.remove(std::unique_ptr<irs::filter>(key_filter("C")));
+  }
+  writer->commit();
+
+  auto reader = open_reader();
+  ASSERT_EQ(2, reader.size());
+
+  const std::vector<std::string> keys{ "A", "B", "C", "D", "E" };
+  std::vector<irs::bytes_ref> refs;
+  for (auto& key : keys) {
+    refs.emplace_back(irs::ref_cast<irs::byte_type>(irs::string_ref(key)));
+  }
+
+  std::vector<irs::primary_key_hit> hits(keys.size());
+  ASSERT_EQ(3, irs::lookup_primary_keys(
+    reader, "id",
+    { refs.data(), refs.size() },
+    { hits.data(), hits.size() }));
+
+  auto assert_hit = [](const irs::primary_key_hit& hit,
+                       const irs::sub_reader& segment,
+                       const irs::string_ref& expected) {
+    ASSERT_EQ(&segment, hit.segment);
+    ASSERT_TRUE(segment.live(hit.doc));
+    auto* column = segment.column_reader("value");
+    ASSERT_NE(nullptr, column);
+    auto values = column->values();
+    irs::bytes_ref actual;
+    ASSERT_TRUE(values(hit.doc, actual));
+    ASSERT_EQ(expected, irs::to_string<irs::string_ref>(actual.c_str()));
+  };
+
+  assert_hit(hits[0], reader[0], "A0");
+  assert_hit(hits[1], reader[1], "B1"); // most recent version
+  ASSERT_EQ(nullptr, hits[2].segment); // removed
+  ASSERT_FALSE(irs::doc_limits::valid(hits[2].doc));
+  assert_hit(hits[3], reader[1], "D1");
+  ASSERT_EQ(nullptr, hits[4].segment); // missing
+  ASSERT_FALSE(irs::doc_limits::valid(hits[4].doc));
+
+  // missing field
+  ASSERT_EQ(0, irs::lookup_primary_keys(
+    reader, "missing",
+    { refs.data(), refs.size() },
+    { hits.data(), hits.size() }));
+  for (auto& hit : hits) {
+    ASSERT_EQ(nullptr, hit.segment);
+  }
+}
+
+TEST_P(index_test_case, insert_columnar_batch) {
+  auto bytes = [](const char* value) {
+    return irs::ref_cast<irs::byte_type>(irs::string_ref(value));
+  };
+
+  irs::string_token_stream analyzer;
+
+  const irs::string_ref names[] { "A", "B", irs::string_ref::NIL, "D" };
+  const irs::bytes_ref stored_names[] {
+    bytes("A"), bytes("B"), irs::bytes_ref::NIL, bytes("D") };
+  const irs::bytes_ref tags[] { bytes("x"), bytes("y"), bytes("y"), bytes("x") };
+  const size_t tags_offsets[] { 0, 2, 2, 3, 4 };
+
+  irs::columnar_batch batch;
+  batch.docs = 4;
+  {
+    auto& column = batch.indexed.emplace_back();
+    column.name = "name";
+    column.analyzer = &analyzer;
+    column.values = { names, IRESEARCH_COUNTOF(names) };
+  }
+  {
+    auto& column = batch.indexed.emplace_back();
+    column.name = "tags";
+    column.terms = { tags, IRESEARCH_COUNTOF(tags) };
+    column.offsets = { tags_offsets, IRESEARCH_COUNTOF(tags_offsets) };
+  }
+  {
+    auto& column = batch.stored.emplace_back();
+    column.name = "name";
+    column.values = { stored_names, IRESEARCH_COUNTOF(stored_names) };
+  }
+  ASSERT_TRUE(batch.valid());
+
+  auto writer = open_writer();
+
+  // invalid batches are rejected as a whole
+  {
+    auto invalid = batch;
+    invalid.docs = 3;
+    ASSERT_FALSE(invalid.valid());
+    ASSERT_FALSE(writer->documents().insert(invalid));
+
+    invalid = batch;
+    invalid.indexed.push_back(invalid.indexed.front());
+    ASSERT_FALSE(invalid.valid());
+    ASSERT_FALSE(writer->documents().insert(invalid));
+  }
+
+  ASSERT_TRUE(writer->documents().insert(batch));
+  writer->commit();
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0];
+  ASSERT_EQ(4, segment.docs_count());
+  ASSERT_EQ(4, segment.live_docs_count());
+
+  auto expect_postings = [&segment](
+      irs::string_ref field_name,
+      std::map<irs::string_ref, std::vector<irs::doc_id_t>> expected) {
+    auto* field = segment.field(field_name);
+    ASSERT_NE(nullptr, field);
+    ASSERT_EQ(expected.size(), field->size());
+
+    auto term = field->iterator(irs::SeekMode::NORMAL);
+    for (auto& [value, docs] : expected) {
+      ASSERT_TRUE(term->next());
+      ASSERT_EQ(value, irs::ref_cast<char>(term->value()));
+
+      std::vector<irs::doc_id_t> actual;
+      for (auto it = term->postings(irs::IndexFeatures::NONE); it->next();) {
+        actual.push_back(it->value());
+      }
+      ASSERT_EQ(docs, actual);
+    }
+    ASSERT_FALSE(term->next());
+  };
+
+  expect_postings("name", { { "A", { 1 } }, { "B", { 2 } }, { "D", { 4 } } });
+  expect_postings("tags", { { "x", { 1, 4 } }, { "y", { 1, 3 } } });
+
+  auto* column = segment.column_reader("name");
+  ASSERT_NE(nullptr, column);
+  auto values = column->values();
+  irs::bytes_ref actual_value;
+  ASSERT_TRUE(values(1, actual_value));
+  ASSERT_EQ("A", irs::ref_cast<char>(actual_value));
+  ASSERT_TRUE(values(2, actual_value));
+  ASSERT_EQ("B", irs::ref_cast<char>(actual_value));
+  ASSERT_FALSE(values(3, actual_value));
+  ASSERT_TRUE(values(4, actual_value));
+  ASSERT_EQ("D", irs::ref_cast<char>(actual_value));
+}
+
+TEST_P(index_test_case, insert_columnar_batch_segment_limits) {
+  auto bytes = [](const char* value) {
+    return irs::ref_cast<irs::byte_type>(irs::string_ref(value));
+  };
+
+  const irs::bytes_ref ids[] {
+    bytes("0"), bytes("1"), bytes("2"), bytes("3"), bytes("4") };
+  const size_t ids_offsets[] { 0, 1, 2, 3, 4, 5 };
+
+  irs::columnar_batch batch;
+  batch.docs = 5;
+  {
+    auto& column = batch.indexed.emplace_back();
+    column.name = "id";
+    column.terms = { ids, IRESEARCH_COUNTOF(ids) };
+    column.offsets = { ids_offsets, IRESEARCH_COUNTOF(ids_offsets) };
+  }
+  {
+    auto& column = batch.stored.emplace_back();
+    column.name = "id";
+    column.values = { ids, IRESEARCH_COUNTOF(ids) };
+  }
+  ASSERT_TRUE(batch.valid());
+
+  irs::index_writer::init_options options;
+  options.segment_docs_max = 2;
+  auto writer = open_writer(irs::OM_CREATE, options);
+
+  // a batch is split so as to respect the limit
+  ASSERT_TRUE(writer->documents().insert(batch));
+  writer->commit();
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(3, reader.size());
+  ASSERT_EQ(5, reader.docs_count());
+
+  std::vector<std::string> expected{ "0", "1", "2", "3", "4" };
+  std::vector<std::string> actual;
+  for (auto& segment : reader) {
+    ASSERT_GE(2, segment.docs_count());
+
+    auto* field = segment.field("id");
+    ASSERT_NE(nullptr, field);
+    ASSERT_EQ(segment.docs_count(), field->docs_count());
+
+    auto* column = segment.column_reader("id");
+    ASSERT_NE(nullptr, column);
+    auto values = column->values();
+    irs::bytes_ref value;
+
+    for (auto docs = segment.docs_iterator(); docs->next();) {
+      ASSERT_TRUE(values(docs->value(), value));
+      actual.emplace_back(irs::ref_cast<char>(value));
+    }
+  }
+  std::sort(actual.begin(), actual.end());
+  ASSERT_EQ(expected, actual);
+}
+
+TEST_P(index_test_case, insert_pre_analyzed_truncated) {
+  irs::analysis::pre_analyzed_token_stream::recorder recorder(
+    irs::analysis::delimited_token_stream::make(","));
+  ASSERT_TRUE(recorder.reset("quick,brown"));
+  while (recorder.next()) { }
+  const irs::bstring data = recorder.data();
+
+  struct {
+    irs::string_ref name() const { return "value"; }
+
+    irs::IndexFeatures index_features() const {
+      return irs::IndexFeatures::NONE;
+    }
+
+    irs::features_t features() const { return {}; }
+
+    irs::token_stream& get_tokens() const {
+      stream_.reset(value_);
+      return stream_;
+    }
+
+    irs::bytes_ref value_;
+    mutable irs::analysis::pre_analyzed_token_stream stream_;
+  } field;
+
+  auto writer = open_writer();
+
+  {
+    auto ctx = writer->documents();
+
+    {
+      auto doc = ctx.insert();
+      field.value_ = data;
+      ASSERT_TRUE(doc.insert<irs::Action::INDEX>(field));
+      tests::templates::string_field id("id", "1");
+      ASSERT_TRUE(doc.insert<irs::Action::INDEX>(id));
+      ASSERT_TRUE(doc);
+    }
+
+    // truncated input doesn't look like the end of a value
+    {
+      auto doc = ctx.insert();
+      field.value_ = irs::bytes_ref(data.c_str(), data.size() - 2);
+      ASSERT_FALSE(doc.insert<irs::Action::INDEX>(field));
+      ASSERT_FALSE(doc);
+    }
+  }
+
+  writer->commit();
+
+  auto reader = open_reader();
+  ASSERT_EQ(1, reader.size());
+  ASSERT_EQ(1, reader.live_docs_count());
+  ASSERT_NE(nullptr, reader[0].field("value"));
+}
+
+TEST_P(index_test_case, commit_async) {
+  constexpr size_t THREADS = 4;
+  constexpr size_t DOCS_PER_THREAD = 1000;
+  constexpr size_t COMMITS = 16;
+
+  auto writer = open_writer();
+  ASSERT_NE(nullptr, writer);
+
+  // insert from other threads while asynchronous commits are queued,
+  // flush contexts switched by the commits get reused a number of times
+  {
+    std::atomic<size_t> inserted{0};
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < THREADS; ++i) {
+      threads.emplace_back([&writer, &inserted, i]() {
+        for (size_t j = 0; j < DOCS_PER_THREAD; ++j) {
+          tests::templates::string_field id(
+            "id", std::to_string(i*DOCS_PER_THREAD + j));
+          auto ctx = writer->documents();
+
+          if (ctx.insert().insert<irs::Action::INDEX | irs::Action::STORE>(id)) {
+            ++inserted;
+          }
+        }
+      });
+    }
+
+    std::vector<std::future<bool>> commits;
+    for (size_t i = 0; i < COMMITS; ++i) {
+      commits.emplace_back(writer->commit_async());
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    commits.emplace_back(writer->commit_async());
+
+    for (auto& commit : commits) {
+      ASSERT_NO_THROW(commit.get());
+    }
+
+    ASSERT_EQ(THREADS*DOCS_PER_THREAD, inserted);
+
+    auto reader = open_reader();
+    ASSERT_EQ(THREADS*DOCS_PER_THREAD, reader.docs_count());
+    ASSERT_EQ(THREADS*DOCS_PER_THREAD, reader.live_docs_count());
+
+    // every document is committed exactly once
+    std::vector<bool> found(THREADS*DOCS_PER_THREAD, false);
+    for (auto& segment : reader) {
+      auto* column = segment.column_reader("id");
+      ASSERT_NE(nullptr, column);
+      auto values = column->values();
+      irs::bytes_ref value;
+
+      for (auto docs = segment.docs_iterator(); docs->next();) {
+        ASSERT_TRUE(values(docs->value(), value));
+        const auto key = std::stoul(static_cast<std::string>(
+          irs::to_string<irs::string_ref>(value.c_str())));
+        ASSERT_LT(key, found.size());
+        ASSERT_FALSE(found[key]);
+        found[key] = true;
+      }
+    }
+  }
+
+  // nothing to commit
+  ASSERT_FALSE(writer->commit_async().get());
+
+  // synchronous commit finishes pending asynchronous commit first
+  {
+    auto reader = open_reader();
+    const auto segments = reader.size();
+
+    {
+      auto ctx = writer->documents();
+      tests::templates::string_field id("id", "A");
+      ASSERT_TRUE(ctx.insert().insert<irs::Action::INDEX>(id));
+    }
+    auto commit = writer->commit_async();
+    ASSERT_FALSE(writer->commit());
+    ASSERT_TRUE(commit.get());
+    ASSERT_EQ(segments + 1, open_reader().size());
+  }
+
+  // pending asynchronous commit is finished on writer destruction
+  {
+    {
+      auto ctx = writer->documents();
+      tests::templates::string_field id("id", "B");
+      ASSERT_TRUE(ctx.insert().insert<irs::Action::INDEX>(id));
+    }
+    auto commit = writer->commit_async();
+    writer.reset();
+    ASSERT_TRUE(commit.get());
+    ASSERT_EQ(THREADS*DOCS_PER_THREAD + 2, open_reader().docs_count());
+  }
+}
+
+TEST_P(index_test_case, commit_async_back_to_back) {
+  // holds syncing of files until released
+  struct blocking_sync_directory : tests::directory_mock {
+    explicit blocking_sync_directory(irs::directory& impl)
+      : directory_mock(impl), released(release.get_future().share()) {
+    }
+
+    virtual bool sync(const std::string& name) noexcept override {
+      if (block) {
+        ++blocked;
+        released.wait();
+      }
+
+      return directory_mock::sync(name);
+    }
+
+    std::promise<void> release;
+    std::shared_future<void> released;
+    std::atomic<bool> block{false};
+    std::atomic<size_t> blocked{0};
+  } dir(this->dir());
+
+  auto insert = [](irs::index_writer& writer, const std::string& key) {
+    auto ctx = writer.documents();
+    tests::templates::string_field id("id", key);
+    return ctx.insert().insert<irs::Action::INDEX>(id);
+  };
+
+  auto writer = irs::index_writer::make(dir, codec(), irs::OM_CREATE);
+  ASSERT_NE(nullptr, writer);
+  ASSERT_TRUE(insert(*writer, "A"));
+
+  dir.block = true;
+  auto first = writer->commit_async();
+
+  // wait for the 1st commit to get stuck in the commit pool
+  while (!dir.blocked) {
+    std::this_thread::yield();
+  }
+
+  ASSERT_TRUE(insert(*writer, "B"));
+
+  // the 2nd call doesn't wait for the 1st commit
+  auto second_call = std::async(std::launch::async, [&writer]() {
+    return writer->commit_async();
+  });
+
+  const auto status = second_call.wait_for(std::chrono::seconds(10));
+  const auto first_status = first.wait_for(std::chrono::seconds(0));
+  dir.release.set_value();
+  ASSERT_EQ(std::future_status::ready, status);
+  ASSERT_EQ(std::future_status::timeout, first_status);
+
+  auto second = second_call.get();
+  ASSERT_TRUE(first.get());
+  ASSERT_TRUE(second.get());
+
+  auto reader = open_reader();
+  ASSERT_EQ(2, reader.docs_count());
+  ASSERT_EQ(2, reader.size());
+
+  // nothing left to commit
+  ASSERT_FALSE(writer->commit_async().get());
+}
+
+TEST_P(index_test_case, nrt_reader) {
+  auto insert_docs = [](irs::index_writer::documents_context& ctx,
+                        std::initializer_list<std::string> keys) {
+    for (auto& key : keys) {
+      tests::templates::string_field id("id", key);
+      ASSERT_TRUE(ctx.insert().insert<irs::Action::INDEX>(id));
+    }
+  };
+
+  auto count_docs = [](const irs::index_reader& reader, irs::string_ref key) {
+    irs::by_term filter;
+    *filter.mutable_field() = "id";
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(key);
+
+    auto prepared = filter.prepare(reader);
+    size_t count = 0;
+    for (auto& segment : reader) {
+      for (auto it = segment.mask(prepared->execute(segment)); it->next(); ) {
+        ++count;
+      }
+    }
+    return count;
+  };
+
+  auto writer = open_writer();
+  ASSERT_NE(nullptr, writer);
+
+  // buffered documents are visible without commit
+  {
+    auto ctx = writer->documents();
+    insert_docs(ctx, { "A", "B" });
+  }
+
+  auto nrt0 = writer->nrt_reader();
+  ASSERT_NE(nullptr, nrt0);
+  ASSERT_EQ(1, nrt0->size());
+  ASSERT_EQ(2, nrt0->docs_count());
+  ASSERT_EQ(2, nrt0->live_docs_count());
+  ASSERT_EQ(1, count_docs(*nrt0, "A"));
+  ASSERT_EQ(1, count_docs(*nrt0, "B"));
+
+  // nothing new is buffered, same segments
+  {
+    auto nrt = writer->nrt_reader();
+    ASSERT_EQ(1, nrt->size());
+    ASSERT_EQ(2, nrt->docs_count());
+  }
+
+  // documents of a segment in use are not visible
+  {
+    auto ctx = writer->documents();
+    insert_docs(ctx, { "C" });
+
+    auto nrt = writer->nrt_reader();
+    ASSERT_EQ(2, nrt->docs_count());
+    ASSERT_EQ(0, count_docs(*nrt, "C"));
+  }
+
+  auto nrt1 = writer->nrt_reader();
+  ASSERT_EQ(3, nrt1->docs_count());
+  ASSERT_EQ(1, count_docs(*nrt1, "C"));
+
+  // previously opened reader is not affected
+  ASSERT_EQ(2, nrt0->docs_count());
+  ASSERT_EQ(0, count_docs(*nrt0, "C"));
+
+  // commit picks up already flushed segments
+  ASSERT_TRUE(writer->commit());
+  {
+    auto reader = open_reader();
+    ASSERT_EQ(nrt1->size(), reader.size());
+    ASSERT_EQ(3, reader.docs_count());
+    ASSERT_EQ(1, count_docs(reader, "A"));
+    ASSERT_EQ(1, count_docs(reader, "C"));
+  }
+
+  // committed segments along with buffered documents
+  {
+    auto ctx = writer->documents();
+    insert_docs(ctx, { "D" });
+  }
+
+  {
+    auto nrt = writer->nrt_reader();
+    ASSERT_EQ(4, nrt->docs_count());
+    ASSERT_EQ(1, count_docs(*nrt, "A"));
+    ASSERT_EQ(1, count_docs(*nrt, "D"));
+  }
+
+  ASSERT_TRUE(writer->commit());
+  {
+    auto reader = open_reader();
+    ASSERT_EQ(4, reader.docs_count());
+    ASSERT_EQ(4, reader.live_docs_count());
+  }
+
+  auto make_filter = [](irs::string_ref key) -> irs::filter::ptr {
+    auto filter = irs::memory::make_unique<irs::by_term>();
+    *filter->mutable_field() = "id";
+    filter->mutable_options()->term = irs::ref_cast<irs::byte_type>(key);
+    return filter;
+  };
+
+  // removals and updates are applied to committed and buffered documents
+  {
+    auto ctx = writer->documents();
+    insert_docs(ctx, { "E", "F" });
+    ctx.remove(make_filter("A"));
+    ctx.remove(make_filter("E"));
+    {
+      auto doc = ctx.replace(make_filter("B"));
+      tests::templates::string_field id("id", "B");
+      ASSERT_TRUE(doc.insert<irs::Action::INDEX>(id));
+    }
+    {
+      // replacement of a missing document is not inserted
+      auto doc = ctx.replace(make_filter("X"));
+      tests::templates::string_field id("id", "X");
+      ASSERT_TRUE(doc.insert<irs::Action::INDEX>(id));
+    }
+    // removal doesn't affect documents inserted after it
+    ctx.remove(make_filter("G"));
+    insert_docs(ctx, { "G" });
+  }
+
+  auto nrt2 = writer->nrt_reader();
+  ASSERT_EQ(9, nrt2->docs_count());
+  ASSERT_EQ(5, nrt2->live_docs_count());
+  ASSERT_EQ(0, count_docs(*nrt2, "A"));
+  ASSERT_EQ(1, count_docs(*nrt2, "B"));
+  ASSERT_EQ(1, count_docs(*nrt2, "C"));
+  ASSERT_EQ(1, count_docs(*nrt2, "D"));
+  ASSERT_EQ(0, count_docs(*nrt2, "E"));
+  ASSERT_EQ(1, count_docs(*nrt2, "F"));
+  ASSERT_EQ(1, count_docs(*nrt2, "G"));
+  ASSERT_EQ(0, count_docs(*nrt2, "X"));
+
+  // previously opened reader is not affected
+  ASSERT_EQ(1, count_docs(*nrt1, "A"));
+
+  // commit is not affected by modifications applied to near-real-time readers
+  ASSERT_TRUE(writer->commit());
+  {
+    auto reader = open_reader();
+    ASSERT_EQ(5, reader.live_docs_count());
+    ASSERT_EQ(0, count_docs(reader, "A"));
+    ASSERT_EQ(1, count_docs(reader, "B"));
+    ASSERT_EQ(0, count_docs(reader, "E"));
+    ASSERT_EQ(1, count_docs(reader, "F"));
+    ASSERT_EQ(1, count_docs(reader, "G"));
+    ASSERT_EQ(0, count_docs(reader, "X"));
+  }
+
+  // modifications are applied incrementally between near-real-time readers
+  {
+    auto ctx = writer->documents();
+    ctx.remove(make_filter("C"));
+  }
+
+  auto nrt3 = writer->nrt_reader();
+  ASSERT_EQ(4, nrt3->live_docs_count());
+  ASSERT_EQ(0, count_docs(*nrt3, "C"));
+  ASSERT_EQ(1, count_docs(*nrt3, "D"));
+
+  {
+    auto ctx = writer->documents();
+    ctx.remove(make_filter("D"));
+    insert_docs(ctx, { "H" });
+  }
+
+  auto nrt4 = writer->nrt_reader();
+  ASSERT_EQ(4, nrt4->live_docs_count());
+  ASSERT_EQ(0, count_docs(*nrt4, "C"));
+  ASSERT_EQ(0, count_docs(*nrt4, "D"));
+  ASSERT_EQ(1, count_docs(*nrt4, "H"));
+
+  // previously opened readers are not affected
+  ASSERT_EQ(5, nrt2->live_docs_count());
+  ASSERT_EQ(1, count_docs(*nrt2, "C"));
+  ASSERT_EQ(4, nrt3->live_docs_count());
+  ASSERT_EQ(1, count_docs(*nrt3, "D"));
+  ASSERT_EQ(0, count_docs(*nrt3, "H"));
+
+  ASSERT_TRUE(writer->commit());
+  {
+    auto reader = open_reader();
+    ASSERT_EQ(4, reader.live_docs_count());
+    ASSERT_EQ(0, count_docs(reader, "C"));
+    ASSERT_EQ(0, count_docs(reader, "D"));
+    ASSERT_EQ(1, count_docs(reader, "H"));
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
   index_test_10,
   index_test_case,
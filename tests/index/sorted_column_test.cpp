@@ -363,4 +363,129 @@ TEST(sorted_column_test, sort) {
   }
 }
 
+TEST(sorted_column_test, sort_normalized) {
+  const uint32_t values[] = {
+    19,45,27,1,73,98,46,48,38,20,60,91,61,80,44,53,88,
+    75,63,39,68,20,11,78,21,100,87,8,9,63,41,35,82,69,
+    56,49,6,46,59,19,16,58,15,21,46,23,99,78,18,89,77,
+    7,2,15,97,10,5,75,13,7,77,12,15,70,95,42,29,26,81,
+    82,74,53,84,13,95,84,51,9,19,18,21,82,22,91,70,68,
+    14,73,30,70,38,85,98,79,75,38,79,85,85,100,91
+  };
+
+  // normalized key is a big-endian representation of a value
+  struct comparator final : irs::comparer {
+    virtual bool has_normalizer() const noexcept override {
+      return true;
+    }
+
+    virtual void normalize(const irs::bytes_ref& value, irs::bstring& out) const override {
+      ++normalized;
+
+      if (value.null()) {
+        return;
+      }
+
+      const auto* pvalue = value.c_str();
+      const auto v = irs::vread<uint32_t>(pvalue);
+      out += irs::byte_type(1);
+      for (size_t shift = 32; shift; ) {
+        shift -= 8;
+        out += irs::byte_type(v >> shift);
+      }
+    }
+
+    virtual bool less(const irs::bytes_ref&, const irs::bytes_ref&) const noexcept override {
+      ++compared;
+      return false;
+    }
+
+    mutable size_t normalized{};
+    mutable size_t compared{};
+  } less;
+
+  irs::segment_meta segment;
+  segment.name = "123";
+
+  irs::memory_directory dir;
+  irs::field_id column_id;
+  irs::doc_map order;
+
+  auto codec = irs::formats::get("1_0");
+  ASSERT_NE(nullptr, codec);
+
+  // write sorted column
+  {
+    auto writer = codec->get_columnstore_writer(false);
+    ASSERT_NE(nullptr, writer);
+
+    writer->prepare(dir, segment);
+
+    irs::sorted_column col({ irs::type<irs::compression::lz4>::get(), {}, true });
+
+    irs::doc_id_t doc = irs::type_limits<irs::type_t::doc_id_t>::min();
+    for (const auto value : values) {
+      col.prepare(doc++);
+      col.write_vint(value);
+    }
+    ASSERT_EQ(IRESEARCH_COUNTOF(values), col.size());
+
+    std::tie(order, column_id) = col.flush(*writer, IRESEARCH_COUNTOF(values), less);
+    ASSERT_TRUE(col.empty());
+    ASSERT_EQ(IRESEARCH_COUNTOF(values), less.normalized); // once per document
+    ASSERT_EQ(0, less.compared); // 'less' is never called
+    ASSERT_EQ(1+IRESEARCH_COUNTOF(values), order.size());
+    ASSERT_TRUE(irs::type_limits<irs::type_t::field_id_t>::valid(column_id));
+
+    irs::flush_state state;
+    state.dir = &dir;
+    state.doc_count = IRESEARCH_COUNTOF(values);
+    state.name = segment.name;
+
+    ASSERT_TRUE(writer->commit(state));
+  }
+
+  // check order, documents with equal values preserve their relative order
+  {
+    std::vector<std::pair<uint32_t, size_t>> expected;
+    for (size_t i = 0; i < IRESEARCH_COUNTOF(values); ++i) {
+      expected.emplace_back(values[i], i);
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const auto& lhs, const auto& rhs) {
+      return lhs.first < rhs.first;
+    });
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(irs::doc_limits::min() + i,
+                order[irs::doc_limits::min() + expected[i].second]);
+    }
+  }
+
+  // read sorted column
+  {
+    auto reader = codec->get_columnstore_reader();
+    ASSERT_NE(nullptr, reader);
+    ASSERT_TRUE(reader->prepare(dir, segment));
+
+    auto column = reader->column(column_id);
+    ASSERT_NE(nullptr, column);
+
+    std::vector<uint32_t> sorted_values(values, values + IRESEARCH_COUNTOF(values));
+    std::sort(sorted_values.begin(), sorted_values.end());
+
+    auto it = column->iterator();
+    auto* payload = irs::get<irs::payload>(*it);
+    ASSERT_TRUE(payload);
+
+    auto begin = sorted_values.begin();
+    while (it->next()) {
+      const auto* pvalue = payload->value.c_str();
+      ASSERT_EQ(*begin, irs::vread<uint32_t>(pvalue));
+      ++begin;
+    }
+    ASSERT_EQ(sorted_values.end(), begin);
+  }
+}
+
 #endif // IRESEARCH_DLL
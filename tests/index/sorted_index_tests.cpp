@@ -842,6 +842,62 @@ TEST_P(sorted_index_test_case, multi_valued_sorting_field) {
   }
 }
 
+TEST_P(sorted_index_test_case, columnar_batch_nil_sorted_value) {
+  auto bytes = [](const char* value) {
+    return irs::ref_cast<irs::byte_type>(irs::string_ref(value));
+  };
+
+  const irs::bytes_ref ids[] { bytes("1"), bytes("2"), bytes("3") };
+  // 'string_comparer' expects length-prefixed values
+  const irs::bytes_ref sorted[] { bytes("\1A"), irs::bytes_ref::NIL, bytes("\1C") };
+
+  irs::columnar_batch batch;
+  batch.docs = 3;
+  batch.sorted = { sorted, IRESEARCH_COUNTOF(sorted) };
+  {
+    auto& column = batch.stored.emplace_back();
+    column.name = "id";
+    column.values = { ids, IRESEARCH_COUNTOF(ids) };
+  }
+  ASSERT_TRUE(batch.valid());
+
+  string_comparer less;
+  irs::index_writer::init_options opts;
+  opts.comparator = &less;
+  auto writer = open_writer(irs::OM_CREATE, opts);
+  ASSERT_NE(nullptr, writer);
+
+  ASSERT_TRUE(writer->documents().insert(batch));
+  writer->commit();
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0];
+  ASSERT_EQ(3, segment.docs_count());
+
+  const auto* sort_column = segment.sort();
+  ASSERT_NE(nullptr, sort_column);
+  auto sort_values = sort_column->values();
+  const auto* id_column = segment.column_reader("id");
+  ASSERT_NE(nullptr, id_column);
+  auto id_values = id_column->values();
+
+  // a NIL value is not stored rather than stored as an empty one
+  std::map<std::string, std::string> actual;
+  for (auto docs = segment.docs_iterator(); docs->next();) {
+    irs::bytes_ref id, value;
+    ASSERT_TRUE(id_values(docs->value(), id));
+    actual[static_cast<std::string>(irs::ref_cast<char>(id))] =
+      sort_values(docs->value(), value)
+        ? irs::to_string<std::string>(value.c_str())
+        : "<nil>";
+  }
+
+  const std::map<std::string, std::string> expected {
+    { "1", "A" }, { "2", "<nil>" }, { "3", "C" } };
+  ASSERT_EQ(expected, actual);
+}
+
 TEST_P(sorted_index_test_case, check_document_order_after_consolidation_dense) {
   tests::json_doc_generator gen(
     resource("simple_sequential.json"),
@@ -26,6 +26,7 @@
 #include "search/all_filter.hpp"
 #include "search/score.hpp"
 #include "search/cost.hpp"
+#include "search/term_filter.hpp"
 
 namespace {
 
@@ -64,6 +65,95 @@ TEST_P(all_filter_test_case, all_sequential) {
   ASSERT_EQ(&score, irs::get_mutable<irs::score>(it.get()));
 }
 
+TEST_P(all_filter_test_case, execute_range) {
+  // add segment
+  {
+    tests::json_doc_generator gen(
+       resource("simple_sequential.json"),
+       &tests::generic_json_field_factory);
+    add_segment(gen);
+  }
+
+  auto collect = [](irs::doc_iterator::ptr&& it) {
+    docs_t docs;
+    auto* doc = irs::get<irs::document>(*it);
+    EXPECT_NE(nullptr, doc);
+    while (it->next()) {
+      EXPECT_EQ(it->value(), doc->value);
+      docs.push_back(it->value());
+    }
+    EXPECT_TRUE(irs::doc_limits::eof(it->value()));
+    EXPECT_FALSE(it->next());
+    return docs;
+  };
+
+  auto make_filter = [](const irs::string_ref& field, const irs::string_ref& term) {
+    irs::by_term filter;
+    *filter.mutable_field() = field;
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(term);
+    return filter;
+  };
+
+  {
+    auto rdr = open_reader();
+    ASSERT_EQ(1, rdr->size());
+    auto& segment = rdr[0];
+    auto all = irs::all().prepare(*rdr);
+    const auto& ord = irs::order::prepared::unordered();
+
+    ASSERT_EQ((docs_t{ 5, 6, 7, 8, 9 }), collect(all->execute(segment, ord, 5, 10)));
+    ASSERT_EQ((docs_t{ 1, 2 }), collect(all->execute(segment, ord, 0, 3)));
+    ASSERT_EQ((docs_t{ 30, 31, 32 }), collect(all->execute(segment, ord, 30, 100)));
+    ASSERT_EQ(32, collect(all->execute(segment, ord, 0, irs::doc_limits::eof())).size());
+    ASSERT_TRUE(collect(all->execute(segment, ord, 10, 10)).empty());
+    ASSERT_TRUE(collect(all->execute(segment, ord, 10, 5)).empty());
+    ASSERT_TRUE(collect(all->execute(segment, ord, 33, 100)).empty());
+
+    // seek within a range
+    {
+      auto it = all->execute(segment, ord, 5, 10);
+      ASSERT_EQ(5, it->seek(2));
+      ASSERT_EQ(5, it->seek(5));
+      ASSERT_EQ(7, it->seek(7));
+      ASSERT_TRUE(it->next());
+      ASSERT_EQ(8, it->value());
+      ASSERT_TRUE(irs::doc_limits::eof(it->seek(10)));
+      ASSERT_FALSE(it->next());
+    }
+
+    // 'duplicated' == 'abcd' for { 1, 5, 11, 21, 27, 31 }
+    auto term = make_filter("duplicated", "abcd").prepare(*rdr);
+    ASSERT_EQ((docs_t{ 11, 21, 27 }), collect(term->execute(segment, ord, 6, 28)));
+    ASSERT_EQ((docs_t{ 31 }), collect(term->execute(segment, ord, 28, 100)));
+    ASSERT_TRUE(collect(term->execute(segment, ord, 12, 21)).empty());
+  }
+
+  // remove 'K'
+  {
+    auto writer = open_writer(irs::OM_APPEND);
+    writer->documents().remove(make_filter("name", "K"));
+    writer->commit();
+  }
+
+  // masked documents are respected
+  {
+    auto rdr = open_reader();
+    ASSERT_EQ(1, rdr->size());
+    auto& segment = rdr[0];
+    const auto& ord = irs::order::prepared::unordered();
+
+    auto all = irs::all().prepare(*rdr);
+    ASSERT_EQ((docs_t{ 9, 10, 12 }),
+              collect(segment.mask(all->execute(segment, ord, 9, 13))));
+
+    // removed documents are filtered out by the caller
+    auto term = make_filter("duplicated", "abcd").prepare(*rdr);
+    ASSERT_EQ((docs_t{ 11, 21, 27 }), collect(term->execute(segment, ord, 6, 28)));
+    ASSERT_EQ((docs_t{ 21, 27 }),
+              collect(segment.mask(term->execute(segment, ord, 6, 28))));
+  }
+}
+
 TEST_P(all_filter_test_case, all_order) {
   // add segment
   {
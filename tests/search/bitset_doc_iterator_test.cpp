@@ -925,4 +925,62 @@ TEST(bitset_iterator_test, seek_next) {
   }
 }
 
+TEST(bitset_iterator_test, next_batch) {
+  // empty
+  {
+    irs::bitset bs;
+    irs::bitset_doc_iterator it(bs.begin(), bs.end());
+    irs::doc_id_t buf[4];
+    ASSERT_EQ(0, it.next_batch(buf, nullptr, IRESEARCH_COUNTOF(buf)));
+    ASSERT_TRUE(irs::doc_limits::eof(it.value()));
+  }
+
+  // batches crossing word boundaries
+  {
+    std::vector<irs::doc_id_t> expected;
+    irs::bitset bs(1000);
+    for (irs::doc_id_t doc = 1; doc < bs.size(); doc += 1 + doc % 7) {
+      bs.set(doc);
+      expected.emplace_back(doc);
+    }
+
+    for (size_t batch : { 1, 3, 64, 65, 2000 }) {
+      SCOPED_TRACE(batch);
+      irs::bitset_doc_iterator it(bs.begin(), bs.end());
+      std::vector<irs::doc_id_t> actual;
+      std::vector<irs::doc_id_t> buf(batch);
+
+      size_t read;
+      do {
+        read = it.next_batch(buf.data(), nullptr, buf.size());
+        actual.insert(actual.end(), buf.begin(), buf.begin() + read);
+        if (read == batch) {
+          ASSERT_EQ(actual.back(), it.value());
+        }
+      } while (read == batch);
+
+      ASSERT_EQ(expected, actual);
+      ASSERT_TRUE(irs::doc_limits::eof(it.value()));
+    }
+  }
+
+  // mix of seek, next and bulk read
+  {
+    irs::bitset bs(256);
+    bs.set(3); bs.set(70); bs.set(71); bs.set(130); bs.set(200);
+
+    irs::bitset_doc_iterator it(bs.begin(), bs.end());
+    irs::doc_id_t buf[2];
+    ASSERT_EQ(70, it.seek(4));
+    ASSERT_EQ(2, it.next_batch(buf, nullptr, IRESEARCH_COUNTOF(buf)));
+    ASSERT_EQ(71, buf[0]);
+    ASSERT_EQ(130, buf[1]);
+    ASSERT_EQ(130, it.value());
+    ASSERT_TRUE(it.next());
+    ASSERT_EQ(200, it.value());
+    ASSERT_EQ(0, it.next_batch(buf, nullptr, IRESEARCH_COUNTOF(buf)));
+    ASSERT_TRUE(irs::doc_limits::eof(it.value()));
+  }
+}
+
 #endif
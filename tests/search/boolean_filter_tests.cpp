@@ -27,6 +27,7 @@
 #include "filter_test_case_base.hpp"
 #include "search/all_filter.hpp"
 #include "search/all_iterator.hpp"
+#include "search/block_conjunction.hpp"
 #include "search/boolean_filter.hpp"
 #include "search/range_filter.hpp"
 #include "search/disjunction.hpp"
@@ -13462,6 +13463,97 @@ TEST(conjunction_test, scored_seek_next) {
   }
 }
 
+TEST(block_conjunction_test, next_seek) {
+  using conjunction = irs::conjunction<irs::doc_iterator::ptr>;
+
+  auto make_docs = [](irs::doc_id_t step, irs::doc_id_t max) {
+    std::vector<irs::doc_id_t> docs;
+    for (irs::doc_id_t doc = step; doc <= max; doc += step) {
+      docs.push_back(doc);
+    }
+    return docs;
+  };
+
+  auto execute = [](const std::vector<std::vector<irs::doc_id_t>>& docs) {
+    irs::block_conjunction::doc_iterators_t itrs;
+    for (const auto& entry : docs) {
+      itrs.emplace_back(irs::memory::make_managed<detail::basic_doc_iterator>(
+        entry.begin(), entry.end()));
+    }
+    return irs::block_conjunction(std::move(itrs));
+  };
+
+  const std::vector<std::vector<std::vector<irs::doc_id_t>>> cases {
+    // balanced, blocks of both iterators are intersected
+    { make_docs(2, 10000), make_docs(3, 10000) },
+    { make_docs(3, 10000), make_docs(2, 10000), make_docs(5, 10000) },
+    // skewed, the longest iterator is probed per candidate
+    { make_docs(2, 100000), make_docs(997, 100000) },
+    { make_docs(997, 100000), make_docs(1, 100000), make_docs(2, 100000) },
+    // no matches
+    { make_docs(2, 10000), { 1, 3, 9999 } },
+    { { 1, 5, 6 }, { 1, 2, 5, 7, 9, 11, 45 }, { 1, 5, 6, 12, 29 } }
+  };
+
+  for (auto& docs : cases) {
+    std::vector<irs::doc_id_t> expected;
+    {
+      conjunction it(detail::execute_all<conjunction::doc_iterator_t>(docs));
+      while (it.next()) {
+        expected.push_back(it.value());
+      }
+    }
+
+    // next
+    {
+      auto it = execute(docs);
+      auto* doc = irs::get<irs::document>(it);
+      ASSERT_TRUE(bool(doc));
+      ASSERT_EQ(std::min_element(docs.begin(), docs.end(),
+                                 [](const auto& lhs, const auto& rhs) {
+                                   return lhs.size() < rhs.size(); })->size(),
+                irs::cost::extract(it));
+      ASSERT_EQ(irs::doc_limits::invalid(), it.value());
+
+      std::vector<irs::doc_id_t> actual;
+      while (it.next()) {
+        actual.push_back(it.value());
+        ASSERT_EQ(it.value(), doc->value);
+      }
+      ASSERT_FALSE(it.next());
+      ASSERT_TRUE(irs::doc_limits::eof(it.value()));
+      ASSERT_EQ(expected, actual);
+    }
+
+    // seek
+    for (irs::doc_id_t skip : { 1, 7, 500, 4000 }) {
+      conjunction expected_it(detail::execute_all<conjunction::doc_iterator_t>(docs));
+      auto it = execute(docs);
+
+      for (irs::doc_id_t target = 1; ; target += skip) {
+        const auto doc = expected_it.seek(target);
+        ASSERT_EQ(doc, it.seek(target));
+        ASSERT_EQ(doc, it.seek(target)); // seek to the same target
+        ASSERT_EQ(doc, it.seek(irs::doc_limits::invalid()));
+
+        if (irs::doc_limits::eof(doc)) {
+          break;
+        }
+
+        // mix with next
+        ASSERT_EQ(expected_it.next(), it.next());
+        ASSERT_EQ(expected_it.value(), it.value());
+
+        if (irs::doc_limits::eof(it.value())) {
+          break;
+        }
+
+        target = std::max(target, it.value());
+      }
+    }
+  }
+}
+
 // ----------------------------------------------------------------------------
 // --SECTION--                                      iterator0 AND NOT iterator1
 // ----------------------------------------------------------------------------
@@ -14109,6 +14201,32 @@ TEST_P(boolean_filter_test_case, and_sequential) {
     append<irs::by_term>(root, "name", "B"); // 2
     check_query(root, docs_t{}, rdr);
   }
+
+  // blocks are intersected only if all clauses read blocks natively
+  {
+    irs::And postings;
+    append<irs::by_term>(postings, "duplicated", "abcd"); // 1,5,11,21,27,31
+    append<irs::by_term>(postings, "same", "xyz"); // 1..32
+
+    irs::And generic;
+    append<irs::by_term>(generic, "duplicated", "abcd"); // 1,5,11,21,27,31
+    auto& sub = generic.add<irs::Or>();
+    append<irs::by_term>(sub, "same", "xyz"); // 1..32
+    append<irs::by_term>(sub, "name", "A"); // 1
+
+    auto postings_query = postings.prepare(rdr);
+    auto generic_query = generic.prepare(rdr);
+
+    for (auto& segment : rdr) {
+      auto it = postings_query->execute(segment);
+      ASSERT_NE(nullptr, dynamic_cast<irs::block_conjunction*>(it.get()));
+      it = generic_query->execute(segment);
+      ASSERT_EQ(nullptr, dynamic_cast<irs::block_conjunction*>(it.get()));
+    }
+
+    check_query(postings, docs_t{ 1, 5, 11, 21, 27, 31 }, rdr);
+    check_query(generic, docs_t{ 1, 5, 11, 21, 27, 31 }, rdr);
+  }
 }
 
 TEST_P(boolean_filter_test_case, not_standalone_sequential_ordered) {
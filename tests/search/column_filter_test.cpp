@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "filter_test_case_base.hpp"
+#include "search/boolean_filter.hpp"
+#include "search/column_filter.hpp"
+#include "search/term_filter.hpp"
+
+namespace {
+
+// big-endian encoding preserves order of unsigned values
+irs::bstring encode(uint32_t value) {
+  irs::bstring buf(sizeof(value), 0);
+  auto* out = &buf[0];
+  irs::write<uint32_t>(out, value);
+  return buf;
+}
+
+irs::by_column_term make_term_filter(
+    const irs::string_ref& field,
+    uint32_t value) {
+  irs::by_column_term filter;
+  *filter.mutable_field() = field;
+  filter.mutable_options()->term = encode(value);
+  return filter;
+}
+
+irs::by_column_range make_range_filter(
+    const irs::string_ref& field,
+    uint32_t min, irs::BoundType min_type,
+    uint32_t max, irs::BoundType max_type) {
+  irs::by_column_range filter;
+  *filter.mutable_field() = field;
+  auto& range = filter.mutable_options()->range;
+  range.min = encode(min);
+  range.min_type = min_type;
+  range.max = encode(max);
+  range.max_type = max_type;
+  return filter;
+}
+
+// stored only field holding big-endian encoded value
+class encoded_field final : public tests::field_base {
+ public:
+  encoded_field(const std::string& name, uint32_t value)
+    : value_(value) {
+    this->name(name);
+  }
+
+  virtual irs::token_stream& get_tokens() const override {
+    return stream_;
+  }
+
+  virtual bool write(irs::data_output& out) const override {
+    out.write_int(value_);
+    return true;
+  }
+
+ private:
+  mutable irs::null_token_stream stream_;
+  uint32_t value_;
+}; // encoded_field
+
+class column_filter_test_case : public tests::filter_test_case_base {
+ protected:
+  void add_sequential_segment() {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      [](tests::document& doc,
+         const std::string& name,
+         const tests::json_doc_generator::json_value& data) {
+        if (name == "seq" && data.is_number()) {
+          doc.insert(std::make_shared<encoded_field>(name, data.as_number<uint32_t>()),
+                     false, true);
+        } else if (name == "duplicated" && data.is_string()) {
+          doc.insert(std::make_shared<tests::templates::string_field>(name, data.str),
+                     true, false);
+        }
+    });
+    add_segment(gen);
+  }
+};
+
+TEST_P(column_filter_test_case, by_column_term) {
+  add_sequential_segment();
+
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr.size());
+  const irs::cost::cost_t column_size = rdr[0].column_reader("seq")->size();
+
+  // single match
+  check_query(make_term_filter("seq", 7), docs_t{ 8 }, costs_t{ column_size }, rdr);
+  check_query(make_term_filter("seq", 0), docs_t{ 1 }, costs_t{ column_size }, rdr);
+  check_query(make_term_filter("seq", 31), docs_t{ 32 }, costs_t{ column_size }, rdr);
+
+  // no match
+  check_query(make_term_filter("seq", 100), docs_t{}, costs_t{ column_size }, rdr);
+
+  // missing column
+  check_query(make_term_filter("missing", 7), docs_t{}, costs_t{ 0 }, rdr);
+}
+
+TEST_P(column_filter_test_case, by_column_range) {
+  add_sequential_segment();
+
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr.size());
+  const irs::cost::cost_t column_size = rdr[0].column_reader("seq")->size();
+
+  // [10, 20)
+  check_query(
+    make_range_filter("seq", 10, irs::BoundType::INCLUSIVE, 20, irs::BoundType::EXCLUSIVE),
+    docs_t{ 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 }, costs_t{ column_size }, rdr);
+
+  // (10, 20]
+  check_query(
+    make_range_filter("seq", 10, irs::BoundType::EXCLUSIVE, 20, irs::BoundType::INCLUSIVE),
+    docs_t{ 12, 13, 14, 15, 16, 17, 18, 19, 20, 21 }, costs_t{ column_size }, rdr);
+
+  // [28, +inf)
+  check_query(
+    make_range_filter("seq", 28, irs::BoundType::INCLUSIVE, 0, irs::BoundType::UNBOUNDED),
+    docs_t{ 29, 30, 31, 32 }, costs_t{ column_size }, rdr);
+
+  // (-inf, 2]
+  check_query(
+    make_range_filter("seq", 0, irs::BoundType::UNBOUNDED, 2, irs::BoundType::INCLUSIVE),
+    docs_t{ 1, 2, 3 }, costs_t{ column_size }, rdr);
+
+  // empty ranges
+  check_query(
+    make_range_filter("seq", 20, irs::BoundType::INCLUSIVE, 10, irs::BoundType::INCLUSIVE),
+    docs_t{}, costs_t{ 0 }, rdr);
+  check_query(
+    make_range_filter("seq", 10, irs::BoundType::EXCLUSIVE, 10, irs::BoundType::INCLUSIVE),
+    docs_t{}, costs_t{ 0 }, rdr);
+
+  // single value range
+  check_query(
+    make_range_filter("seq", 10, irs::BoundType::INCLUSIVE, 10, irs::BoundType::INCLUSIVE),
+    docs_t{ 11 }, costs_t{ column_size }, rdr);
+}
+
+TEST_P(column_filter_test_case, conjunction_verification) {
+  add_sequential_segment();
+
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr.size());
+  auto& segment = rdr[0];
+
+  // 'duplicated' == 'abcd' for 'seq' in { 0, 4, 10, 20, 26, 30 }
+  irs::And filter;
+  {
+    auto& term = filter.add<irs::by_term>();
+    *term.mutable_field() = "duplicated";
+    term.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("abcd"));
+  }
+  {
+    auto& range = filter.add<irs::by_column_range>();
+    *range.mutable_field() = "seq";
+    auto& opts = *range.mutable_options();
+    opts.range.min = encode(5);
+    opts.range.min_type = irs::BoundType::INCLUSIVE;
+    opts.range.max = encode(26);
+    opts.range.max_type = irs::BoundType::INCLUSIVE;
+  }
+
+  // selective term leg drives the conjunction
+  check_query(filter, docs_t{ 11, 21, 27 }, costs_t{ 6 }, rdr);
+
+  // seek through conjunction
+  {
+    auto prepared = filter.prepare(rdr, irs::order::prepared::unordered());
+    auto it = prepared->execute(segment);
+    ASSERT_EQ(11, it->seek(2));
+    ASSERT_EQ(11, it->seek(11));
+    ASSERT_EQ(27, it->seek(22));
+    ASSERT_TRUE(irs::doc_limits::eof(it->seek(28)));
+  }
+
+  // seek through column filter directly
+  {
+    auto prepared = make_range_filter(
+      "seq", 5, irs::BoundType::INCLUSIVE, 26, irs::BoundType::INCLUSIVE)
+        .prepare(rdr, irs::order::prepared::unordered());
+    auto it = prepared->execute(segment);
+    ASSERT_EQ(6, it->seek(1));
+    ASSERT_EQ(6, it->seek(6));
+    ASSERT_EQ(20, it->seek(20));
+    ASSERT_TRUE(it->next());
+    ASSERT_EQ(21, it->value());
+    ASSERT_TRUE(irs::doc_limits::eof(it->seek(28)));
+    ASSERT_FALSE(it->next());
+  }
+}
+
+TEST(by_column_term_test, equal) {
+  ASSERT_EQ(irs::by_column_term(), irs::by_column_term());
+  ASSERT_EQ(make_term_filter("seq", 1), make_term_filter("seq", 1));
+  ASSERT_EQ(make_term_filter("seq", 1).hash(), make_term_filter("seq", 1).hash());
+  ASSERT_NE(make_term_filter("seq", 1), make_term_filter("seq", 2));
+  ASSERT_NE(make_term_filter("seq", 1), make_term_filter("seq1", 1));
+}
+
+TEST(by_column_range_test, equal) {
+  ASSERT_EQ(irs::by_column_range(), irs::by_column_range());
+
+  auto q0 = make_range_filter("seq", 1, irs::BoundType::INCLUSIVE, 2, irs::BoundType::EXCLUSIVE);
+  auto q1 = make_range_filter("seq", 1, irs::BoundType::INCLUSIVE, 2, irs::BoundType::EXCLUSIVE);
+  ASSERT_EQ(q0, q1);
+  ASSERT_EQ(q0.hash(), q1.hash());
+  ASSERT_NE(q0, make_range_filter("seq", 1, irs::BoundType::INCLUSIVE, 2, irs::BoundType::INCLUSIVE));
+  ASSERT_NE(q0, make_range_filter("seq", 0, irs::BoundType::INCLUSIVE, 2, irs::BoundType::EXCLUSIVE));
+  ASSERT_NE(q0, make_range_filter("seq1", 1, irs::BoundType::INCLUSIVE, 2, irs::BoundType::EXCLUSIVE));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  column_filter_test,
+  column_filter_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory,
+      &tests::mmap_directory
+    ),
+    ::testing::Values("1_0", "1_4")
+  ),
+  tests::to_string
+);
+
+}
@@ -0,0 +1,348 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "filter_test_case_base.hpp"
+#include "search/all_filter.hpp"
+#include "search/bm25.hpp"
+#include "search/boolean_filter.hpp"
+#include "search/parallel_executor.hpp"
+#include "search/score.hpp"
+#include "search/term_filter.hpp"
+
+namespace {
+
+class parallel_executor_test_case : public tests::filter_test_case_base {
+ protected:
+  void write_index() {
+    // one large segment
+    {
+      auto writer = open_writer(irs::OM_CREATE);
+
+      std::vector<tests::doc_generator_base::ptr> gens;
+      gens.emplace_back(new tests::json_doc_generator(
+        resource("AdventureWorks2014.json"),
+        &tests::generic_json_field_factory));
+      gens.emplace_back(new tests::json_doc_generator(
+        resource("Northwnd.json"),
+        &tests::generic_json_field_factory));
+      add_segments(*writer, gens);
+    }
+
+    // a couple of small segments
+    for (size_t i = 0; i < 2; ++i) {
+      tests::json_doc_generator gen(
+        resource("simple_sequential.json"),
+        &tests::generic_json_field_factory);
+      add_segment(gen, irs::OM_APPEND);
+    }
+  }
+
+  // sequential execution of a query used as a reference
+  static irs::parallel_executor::scored_docs execute(
+      const irs::filter::prepared& query,
+      const irs::index_reader& rdr,
+      const irs::order::prepared& ord) {
+    irs::parallel_executor::scored_docs docs;
+    const irs::bstring no_score(ord.score_size(), 0);
+
+    for (size_t i = 0; i < rdr.size(); ++i) {
+      auto it = rdr[i].mask(query.execute(rdr[i], ord));
+      const auto* score = irs::get<irs::score>(*it);
+
+      while (it->next()) {
+        if (score && !score->is_default()) {
+          docs.push_back({ irs::bstring(score->evaluate(), ord.score_size()), i, it->value() });
+        } else {
+          docs.push_back({ no_score, i, it->value() });
+        }
+      }
+    }
+
+    std::sort(docs.begin(), docs.end(),
+              [&ord](const auto& lhs, const auto& rhs) {
+      if (ord.less(lhs.score.c_str(), rhs.score.c_str())) {
+        return true;
+      }
+
+      if (ord.less(rhs.score.c_str(), lhs.score.c_str())) {
+        return false;
+      }
+
+      return std::make_pair(lhs.segment, lhs.doc) < std::make_pair(rhs.segment, rhs.doc);
+    });
+
+    return docs;
+  }
+
+  static std::vector<irs::parallel_executor::options> options() {
+    std::vector<irs::parallel_executor::options> opts;
+
+    for (size_t concurrency : { 0, 1, 2, 8 }) {
+      for (irs::doc_id_t range_size : { 0, 1, 64, 100 }) {
+        opts.push_back({ concurrency, range_size, nullptr });
+      }
+    }
+
+    return opts;
+  }
+};
+
+TEST_P(parallel_executor_test_case, collect) {
+  write_index();
+
+  auto rdr = open_reader();
+  ASSERT_EQ(3, rdr.size());
+  ASSERT_LT(128, rdr[0].docs_count());
+
+  irs::async_utils::thread_pool pool(4, 4);
+  irs::parallel_executor executor(pool);
+
+  irs::Or filter;
+  {
+    auto& sub = filter.add<irs::by_term>();
+    *sub.mutable_field() = "same";
+    sub.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("xyz"));
+  }
+  filter.add<irs::all>().boost(0.f);
+
+  auto prepared = filter.prepare(rdr, irs::order::prepared::unordered());
+  ASSERT_NE(nullptr, prepared);
+
+  const auto expected = execute(*prepared, rdr, irs::order::prepared::unordered());
+  ASSERT_FALSE(expected.empty());
+
+  for (auto& opts : options()) {
+    irs::parallel_executor::segment_docs actual;
+    ASSERT_TRUE(executor.collect(*prepared, rdr, actual, opts));
+    ASSERT_EQ(rdr.size(), actual.size());
+
+    size_t count = 0;
+    for (auto& docs : actual) {
+      count += docs.count();
+    }
+    ASSERT_EQ(expected.size(), count);
+
+    for (auto& doc : expected) {
+      ASSERT_TRUE(actual[doc.segment].test(doc.doc));
+    }
+  }
+}
+
+TEST_P(parallel_executor_test_case, top_k) {
+  write_index();
+
+  auto rdr = open_reader();
+  ASSERT_EQ(3, rdr.size());
+
+  irs::async_utils::thread_pool pool(4, 4);
+  irs::parallel_executor executor(pool);
+
+  irs::order order;
+  order.add<irs::bm25_sort>(true);
+  auto ord = order.prepare();
+
+  irs::Or filter;
+  {
+    auto& sub = filter.add<irs::by_term>();
+    *sub.mutable_field() = "same";
+    sub.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("xyz"));
+  }
+  {
+    auto& sub = filter.add<irs::by_term>();
+    *sub.mutable_field() = "duplicated";
+    sub.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("abcd"));
+  }
+  filter.add<irs::all>();
+
+  auto prepared = filter.prepare(rdr, ord);
+  ASSERT_NE(nullptr, prepared);
+
+  const auto expected = execute(*prepared, rdr, ord);
+  ASSERT_LT(20, expected.size());
+
+  for (size_t limit : { 1, 10, 20 }) {
+    for (auto& opts : options()) {
+      irs::parallel_executor::scored_docs actual;
+      ASSERT_TRUE(executor.top_k(*prepared, rdr, ord, limit, actual, opts));
+      ASSERT_EQ(limit, actual.size());
+
+      for (size_t i = 0; i < limit; ++i) {
+        ASSERT_EQ(expected[i].segment, actual[i].segment);
+        ASSERT_EQ(expected[i].doc, actual[i].doc);
+        ASSERT_EQ(expected[i].score, actual[i].score);
+      }
+    }
+  }
+
+  // limit exceeds number of matches
+  {
+    irs::parallel_executor::scored_docs actual;
+    ASSERT_TRUE(executor.top_k(*prepared, rdr, ord, expected.size() + 1, actual));
+    ASSERT_EQ(expected.size(), actual.size());
+  }
+
+  // zero limit
+  {
+    irs::parallel_executor::scored_docs actual;
+    ASSERT_TRUE(executor.top_k(*prepared, rdr, ord, 0, actual));
+    ASSERT_TRUE(actual.empty());
+  }
+}
+
+TEST_P(parallel_executor_test_case, removed_docs) {
+  write_index();
+
+  auto make_filter = [](const irs::string_ref& field, const irs::string_ref& term) {
+    irs::by_term filter;
+    *filter.mutable_field() = field;
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(term);
+    return filter;
+  };
+
+  // remove documents from each segment
+  {
+    const auto large = make_filter("source", "AdventureWorks2014");
+    const auto small = make_filter("duplicated", "abcd");
+
+    auto writer = open_writer(irs::OM_APPEND);
+    writer->documents().remove(large);
+    writer->documents().remove(small);
+    ASSERT_TRUE(writer->commit());
+  }
+
+  auto rdr = open_reader();
+  ASSERT_EQ(3, rdr.size());
+  for (auto& segment : rdr) {
+    ASSERT_LT(segment.live_docs_count(), segment.docs_count());
+  }
+
+  irs::async_utils::thread_pool pool(4, 4);
+  irs::parallel_executor executor(pool);
+
+  irs::Or filter;
+  {
+    auto& sub = filter.add<irs::by_term>();
+    *sub.mutable_field() = "same";
+    sub.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("xyz"));
+  }
+  filter.add<irs::all>();
+
+  // collect
+  {
+    auto prepared = filter.prepare(rdr, irs::order::prepared::unordered());
+    ASSERT_NE(nullptr, prepared);
+
+    const auto expected = execute(*prepared, rdr, irs::order::prepared::unordered());
+    ASSERT_EQ(rdr.live_docs_count(), expected.size());
+
+    for (auto& opts : options()) {
+      irs::parallel_executor::segment_docs actual;
+      ASSERT_TRUE(executor.collect(*prepared, rdr, actual, opts));
+      ASSERT_EQ(rdr.size(), actual.size());
+
+      size_t count = 0;
+      for (auto& docs : actual) {
+        count += docs.count();
+      }
+      ASSERT_EQ(expected.size(), count);
+
+      for (auto& doc : expected) {
+        ASSERT_TRUE(actual[doc.segment].test(doc.doc));
+      }
+    }
+  }
+
+  // top_k
+  {
+    irs::order order;
+    order.add<irs::bm25_sort>(true);
+    auto ord = order.prepare();
+
+    auto prepared = filter.prepare(rdr, ord);
+    ASSERT_NE(nullptr, prepared);
+
+    const auto expected = execute(*prepared, rdr, ord);
+    ASSERT_EQ(rdr.live_docs_count(), expected.size());
+
+    for (size_t limit : { size_t(10), expected.size() }) {
+      for (auto& opts : options()) {
+        irs::parallel_executor::scored_docs actual;
+        ASSERT_TRUE(executor.top_k(*prepared, rdr, ord, limit, actual, opts));
+        ASSERT_EQ(limit, actual.size());
+
+        for (size_t i = 0; i < limit; ++i) {
+          ASSERT_TRUE(rdr[actual[i].segment].live(actual[i].doc));
+          ASSERT_EQ(expected[i].segment, actual[i].segment);
+          ASSERT_EQ(expected[i].doc, actual[i].doc);
+          ASSERT_EQ(expected[i].score, actual[i].score);
+        }
+      }
+    }
+  }
+}
+
+TEST_P(parallel_executor_test_case, cancel) {
+  write_index();
+
+  auto rdr = open_reader();
+
+  irs::async_utils::thread_pool pool(4, 4);
+  irs::parallel_executor executor(pool);
+
+  auto prepared = irs::all().prepare(rdr);
+  ASSERT_NE(nullptr, prepared);
+
+  std::atomic<bool> cancel{true};
+  irs::parallel_executor::options opts;
+  opts.cancel = &cancel;
+
+  irs::parallel_executor::segment_docs docs;
+  ASSERT_FALSE(executor.collect(*prepared, rdr, docs, opts));
+  ASSERT_EQ(rdr.size(), docs.size());
+  for (auto& segment_docs : docs) {
+    ASSERT_TRUE(segment_docs.none());
+  }
+
+  irs::parallel_executor::scored_docs scored;
+  ASSERT_FALSE(executor.top_k(*prepared, rdr, irs::order::prepared::unordered(),
+                              10, scored, opts));
+  ASSERT_TRUE(scored.empty());
+
+  cancel = false;
+  ASSERT_TRUE(executor.top_k(*prepared, rdr, irs::order::prepared::unordered(),
+                             10, scored, opts));
+  ASSERT_EQ(10, scored.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  parallel_executor_test,
+  parallel_executor_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory
+    ),
+    ::testing::Values("1_0", "1_4")
+  ),
+  tests::to_string
+);
+
+}
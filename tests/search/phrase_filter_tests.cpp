@@ -23,6 +23,7 @@
 
 #include "tests_shared.hpp"
 #include "filter_test_case_base.hpp"
+#include "analysis/shingle_token_stream.hpp"
 #include "analysis/token_attributes.hpp"
 #include "search/phrase_filter.hpp"
 #ifndef IRESEARCH_DLL
@@ -7378,6 +7379,195 @@ TEST(by_phrase_test, options) {
   ASSERT_EQ(opts.begin(), opts.end());
 }
 
+TEST_P(phrase_filter_test_case, shingles) {
+  typedef tests::templates::text_field<std::string> text_field;
+
+  // same text indexed with and without shingles
+  auto make_generator = [this](bool shingles) {
+    return tests::json_doc_generator(
+      resource("phrase_sequential.json"),
+      [shingles](tests::document& doc,
+                 const std::string& name,
+                 const tests::json_doc_generator::json_value& data) {
+        if (name != "phrase" || !data.is_string()) {
+          return;
+        }
+
+        doc.indexed.push_back(std::make_shared<text_field>("phrase_anl", data.str));
+
+        auto field = std::make_shared<text_field>("phrase_shingles", data.str);
+        if (shingles) {
+          field->features_.push_back(irs::type<irs::phrase_shingles>::id());
+        }
+        doc.indexed.push_back(field);
+    });
+  };
+
+  auto collect = [](const irs::filter& q, const irs::index_reader& rdr) {
+    auto prepared = q.prepare(rdr, irs::order::prepared::unordered());
+    std::vector<irs::doc_id_t> docs;
+    for (auto& segment : rdr) {
+      auto it = prepared->execute(segment);
+      while (it->next()) {
+        docs.push_back(it->value());
+      }
+    }
+    return docs;
+  };
+
+  irs::index_writer::init_options opts;
+  opts.features.emplace(irs::type<irs::phrase_shingles>::id(), nullptr);
+
+  // 'offs' is a gap before the last term
+  auto query = [](irs::string_ref field,
+                  const std::vector<irs::string_ref>& terms,
+                  size_t offs = 0) {
+    irs::by_phrase q;
+    *q.mutable_field() = field;
+    for (size_t i = 0; i < terms.size(); ++i) {
+      q.mutable_options()->push_back<irs::by_term_options>(
+          i + 1 == terms.size() ? offs : 0).term =
+        irs::ref_cast<irs::byte_type>(terms[i]);
+    }
+    return q;
+  };
+
+  auto assert_phrases = [&](const irs::index_reader& rdr) {
+    const std::vector<std::vector<irs::string_ref>> phrases {
+      { "quick", "brown" },
+      { "quick", "brown", "fox" },
+      { "brown", "fox", "jumps", "over" },
+      { "eye", "to", "eye" },
+      { "the", "past" },
+      { "fox", "quick" },
+      { "quick", "missing" },
+      { "missing", "brown", "fox" }
+    };
+
+    for (auto& phrase : phrases) {
+      const auto expected = collect(query("phrase_anl", phrase), rdr);
+      check_query(query("phrase_shingles", phrase), expected, rdr);
+    }
+
+    // gaps between terms aren't covered by shingles
+    {
+      const auto expected = collect(query("phrase_anl", { "quick", "fox" }, 1), rdr);
+      ASSERT_FALSE(expected.empty());
+
+      check_query(query("phrase_shingles", { "quick", "fox" }, 1), expected, rdr);
+    }
+  };
+
+  // segment with shingles
+  {
+    auto gen = make_generator(true);
+    add_segment(gen, irs::OM_CREATE, opts);
+
+    auto rdr = open_reader();
+    ASSERT_EQ(1, rdr.size());
+    auto& segment = rdr[0];
+
+    auto* field = segment.field("phrase_shingles");
+    ASSERT_NE(nullptr, field);
+    ASSERT_EQ(1, field->meta().features.count(irs::type<irs::phrase_shingles>::id()));
+    ASSERT_NE(nullptr, segment.field(irs::shingle_field("phrase_shingles")));
+    ASSERT_EQ(nullptr, segment.field(irs::shingle_field("phrase_anl")));
+
+    // 2 terms phrase is evaluated as a single shingle
+    {
+      irs::by_term q;
+      *q.mutable_field() = irs::shingle_field("phrase_shingles");
+      q.mutable_options()->term = irs::make_shingle(
+        irs::ref_cast<irs::byte_type>(irs::string_ref("quick")),
+        irs::ref_cast<irs::byte_type>(irs::string_ref("brown")));
+
+      const auto expected = collect(q, rdr);
+      ASSERT_FALSE(expected.empty());
+
+      check_query(query("phrase_shingles", { "quick", "brown" }), expected, rdr);
+    }
+
+    assert_phrases(rdr);
+  }
+
+  // segment without shingles, falls back to position checks
+  {
+    auto gen = make_generator(false);
+    add_segment(gen, irs::OM_APPEND, opts);
+
+    auto rdr = open_reader();
+    ASSERT_EQ(2, rdr.size());
+    ASSERT_EQ(0, rdr[1].field("phrase_shingles")->meta().features.count(
+      irs::type<irs::phrase_shingles>::id()));
+
+    assert_phrases(rdr);
+  }
+}
+
+TEST_P(phrase_filter_test_case, shingles_multivalued) {
+  typedef tests::templates::text_field<std::string> text_field;
+
+  // positions of a field continue across its instances in a document
+  const std::vector<std::vector<std::string>> docs {
+    { "a b c", "c d" },
+    { "b c d" },
+    { "a b", "c" }
+  };
+
+  irs::index_writer::init_options opts;
+  opts.features.emplace(irs::type<irs::phrase_shingles>::id(), nullptr);
+
+  {
+    auto writer = open_writer(irs::OM_CREATE, opts);
+    {
+      auto ctx = writer->documents();
+
+      for (auto& values : docs) {
+        auto doc = ctx.insert();
+
+        for (auto& value : values) {
+          text_field plain("phrase_anl", value);
+          ASSERT_TRUE(doc.insert<irs::Action::INDEX>(plain));
+
+          text_field shingled("phrase_shingles", value);
+          shingled.features_.push_back(irs::type<irs::phrase_shingles>::id());
+          ASSERT_TRUE(doc.insert<irs::Action::INDEX>(shingled));
+        }
+      }
+    }
+    ASSERT_TRUE(writer->commit());
+  }
+
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr.size());
+  ASSERT_NE(nullptr, rdr[0].field(irs::shingle_field("phrase_shingles")));
+
+  auto query = [](irs::string_ref field,
+                  const std::vector<irs::string_ref>& terms) {
+    irs::by_phrase q;
+    *q.mutable_field() = field;
+    for (auto& term : terms) {
+      q.mutable_options()->push_back<irs::by_term_options>().term =
+        irs::ref_cast<irs::byte_type>(term);
+    }
+    return q;
+  };
+
+  const std::vector<std::pair<std::vector<irs::string_ref>, docs_t>> phrases {
+    { { "b", "c", "d" }, { 2 } }, // 'c' of the 1st document is repeated
+    { { "c", "c" }, { 1 } },
+    { { "c", "c", "d" }, { 1 } },
+    { { "b", "c" }, { 1, 2, 3 } },
+    { { "a", "b", "c" }, { 1, 3 } }, // spans instances
+    { { "d", "a" }, { } }
+  };
+
+  for (auto& [phrase, expected] : phrases) {
+    check_query(query("phrase_anl", phrase), expected, rdr);
+    check_query(query("phrase_shingles", phrase), expected, rdr);
+  }
+}
+
 TEST(by_phrase_test, options_clear) {
   irs::by_phrase_options opts;
   ASSERT_TRUE(opts.simple());
@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "filter_test_case_base.hpp"
+#include "search/boolean_filter.hpp"
+#include "search/prefix_filter.hpp"
+#include "search/query_arena.hpp"
+#include "search/query_profile.hpp"
+#include "search/term_filter.hpp"
+
+namespace {
+
+struct tracked {
+  tracked(std::vector<int>& log, int id) noexcept : log(&log), id(id) { }
+  ~tracked() { log->push_back(id); }
+
+  std::vector<int>* log;
+  int id;
+};
+
+struct alignas(64) over_aligned {
+  char data[3];
+};
+
+TEST(query_arena_test, allocate) {
+  irs::query_arena arena(nullptr, 128);
+  ASSERT_EQ(0, arena.capacity());
+
+  for (size_t i = 0; i < 100; ++i) {
+    auto* p = arena.allocate(i % 13 + 1, 8);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(p) % 8);
+  }
+
+  auto* aligned = arena.create<over_aligned>();
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(aligned) % 64);
+
+  // allocation exceeding a block size
+  auto* huge = static_cast<irs::byte_type*>(arena.allocate(1024, 16));
+  std::memset(huge, 0, 1024);
+  ASSERT_GE(arena.capacity(), 1024 + 128);
+
+  // the first block is kept for reuse
+  arena.reset();
+  ASSERT_EQ(128, arena.capacity());
+  arena.allocate(64, 8);
+  ASSERT_EQ(128, arena.capacity());
+}
+
+TEST(query_arena_test, create_destroy) {
+  std::vector<int> log;
+
+  {
+    irs::query_arena arena(nullptr, 64);
+    for (int i = 0; i < 10; ++i) {
+      auto* obj = arena.create<tracked>(log, i);
+      ASSERT_EQ(i, obj->id);
+    }
+    ASSERT_TRUE(log.empty());
+
+    // objects are destroyed in reverse order
+    arena.reset();
+    ASSERT_EQ((std::vector<int>{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 }), log);
+
+    log.clear();
+    arena.create<tracked>(log, 42);
+  }
+
+  // by destructor
+  ASSERT_EQ(std::vector<int>{ 42 }, log);
+}
+
+TEST(query_arena_test, make_managed) {
+  std::vector<int> log;
+
+  // no arena, object is owned by a pointer
+  {
+    auto ptr = irs::query_arena::make_managed<tracked>(nullptr, log, 1);
+    ASSERT_NE(nullptr, ptr);
+  }
+  ASSERT_EQ(std::vector<int>{ 1 }, log);
+  log.clear();
+
+  // arena accessible via a parent context
+  irs::query_arena arena;
+  irs::query_profile profile;
+  ASSERT_EQ(&profile, irs::get<irs::query_profile>(irs::query_arena(&profile)));
+  ASSERT_EQ(&arena, irs::get<irs::query_arena>(arena));
+
+  {
+    auto ptr = irs::query_arena::make_managed<tracked>(&arena, log, 2);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_NE(0, arena.capacity());
+  }
+  ASSERT_TRUE(log.empty()); // object is owned by an arena
+
+  arena.reset();
+  ASSERT_EQ(std::vector<int>{ 2 }, log);
+}
+
+class query_arena_test_case : public tests::filter_test_case_base { };
+
+TEST_P(query_arena_test_case, prepare_execute) {
+  {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      &tests::generic_json_field_factory);
+    add_segment(gen);
+  }
+
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr->size());
+  auto& segment = (*rdr)[0];
+
+  // same:xyz AND (duplicated:abcd OR prefix:ab*) AND NOT name:C
+  irs::And root;
+  {
+    auto& sub = root.add<irs::by_term>();
+    *sub.mutable_field() = "same";
+    sub.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("xyz"));
+  }
+  {
+    auto& disj = root.add<irs::Or>();
+    auto& term = disj.add<irs::by_term>();
+    *term.mutable_field() = "duplicated";
+    term.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("abcd"));
+    auto& prefix = disj.add<irs::by_prefix>();
+    *prefix.mutable_field() = "prefix";
+    prefix.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("ab"));
+  }
+  {
+    auto& sub = root.add<irs::Not>().filter<irs::by_term>();
+    *sub.mutable_field() = "name";
+    sub.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("C"));
+  }
+
+  auto collect = [&segment](const irs::filter::prepared& query,
+                            const irs::attribute_provider* ctx) {
+    docs_t docs;
+    auto it = query.execute(segment, irs::order::prepared::unordered(), ctx);
+    while (it->next()) {
+      docs.push_back(it->value());
+    }
+    return docs;
+  };
+
+  auto heap_query = root.prepare(*rdr);
+  ASSERT_NE(nullptr, heap_query);
+  const auto expected = collect(*heap_query, nullptr);
+  ASSERT_FALSE(expected.empty());
+
+  irs::query_arena arena;
+
+  // the same arena serves several consecutive queries
+  for (size_t i = 0; i < 3; ++i) {
+    {
+      auto query = root.prepare(*rdr, irs::order::prepared::unordered(),
+                                irs::no_boost(), &arena);
+      ASSERT_NE(nullptr, query);
+      ASSERT_NE(0, arena.capacity());
+      ASSERT_EQ(expected, collect(*query, &arena));
+    }
+
+    arena.reset();
+  }
+
+  // arena along with profiling
+  {
+    irs::query_profile profile;
+    auto query = profile.prepare(root, *rdr, irs::order::prepared::unordered(), &arena);
+    ASSERT_NE(nullptr, query);
+    ASSERT_EQ(expected, collect(*query, &profile));
+    ASSERT_FALSE(profile.root().children.empty());
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  query_arena_test,
+  query_arena_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory
+    ),
+    ::testing::Values("1_0")
+  ),
+  tests::to_string
+);
+
+}
@@ -0,0 +1,459 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "filter_test_case_base.hpp"
+#include "search/all_filter.hpp"
+#include "search/boolean_filter.hpp"
+#include "search/prefix_filter.hpp"
+#include "search/query_profile.hpp"
+#include "search/term_filter.hpp"
+
+namespace {
+
+template<typename Filter>
+Filter& append(irs::boolean_filter& root,
+               const irs::string_ref& name,
+               const irs::string_ref& term) {
+  auto& sub = root.add<Filter>();
+  *sub.mutable_field() = name;
+  sub.mutable_options()->term = irs::ref_cast<irs::byte_type>(term);
+  return sub;
+}
+
+class query_profile_test_case : public tests::filter_test_case_base {
+ protected:
+  // execute a filter without scoring and return strategies chosen
+  // for a top node of the filter
+  const irs::plan_stats& plans(
+      irs::query_profile& profile,
+      const irs::filter& filter,
+      const irs::index_reader& rdr,
+      docs_t& docs) const {
+    auto prepared = profile.prepare(filter, rdr, irs::order::prepared::unordered());
+    EXPECT_NE(nullptr, prepared);
+
+    docs.clear();
+    for (auto& segment : rdr) {
+      auto it = prepared->execute(segment, irs::order::prepared::unordered(), &profile);
+      while (it->next()) {
+        docs.push_back(it->value());
+      }
+    }
+
+    EXPECT_EQ(1, profile.root().children.size());
+    return profile.root().children.front()->plans;
+  }
+};
+
+TEST_P(query_profile_test_case, profile_boolean_tree) {
+  {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      &tests::generic_json_field_factory);
+    add_segment(gen);
+  }
+
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr->size());
+  auto& segment = (*rdr)[0];
+
+  // same:xyz AND (duplicated:abcd OR duplicated:vczc) AND NOT name:C
+  irs::And root;
+  append<irs::by_term>(root, "same", "xyz");
+  {
+    auto& sub = root.add<irs::Or>();
+    append<irs::by_term>(sub, "duplicated", "abcd");
+    append<irs::by_term>(sub, "duplicated", "vczc");
+  }
+  {
+    auto& sub = root.add<irs::Not>().filter<irs::by_term>();
+    *sub.mutable_field() = "name";
+    sub.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("C"));
+  }
+
+  const docs_t expected{ 1, 2, 5, 8, 11, 14, 17, 19, 21, 24, 27, 31 };
+
+  irs::query_profile profile;
+  auto prepared = profile.prepare(root, *rdr, irs::order::prepared::unordered());
+  ASSERT_NE(nullptr, prepared);
+
+  {
+    docs_t actual;
+    auto it = prepared->execute(segment, irs::order::prepared::unordered(), &profile);
+    auto* doc = irs::get<irs::document>(*it);
+    ASSERT_NE(nullptr, doc);
+    while (it->next()) {
+      ASSERT_EQ(it->value(), doc->value);
+      actual.push_back(it->value());
+    }
+    ASSERT_EQ(expected, actual);
+  } // profiling iterators publish their stats on destruction
+
+  // profile structure matches the boolean tree
+  auto& top = profile.root();
+  ASSERT_EQ(1, top.children.size());
+  auto& and_node = *top.children.front();
+  ASSERT_EQ(irs::type<irs::And>::name(), irs::string_ref(and_node.name));
+  ASSERT_EQ(1, and_node.executions.load());
+  ASSERT_EQ(expected.size() + 1, and_node.nexts.load());
+  ASSERT_EQ(expected.size(), and_node.docs.load());
+  ASSERT_EQ(0, and_node.seeks.load());
+
+  ASSERT_EQ(3, and_node.children.size());
+  ASSERT_EQ(irs::type<irs::by_term>::name(), irs::string_ref(and_node.children[0]->name));
+  ASSERT_EQ(irs::type<irs::Or>::name(), irs::string_ref(and_node.children[1]->name));
+  ASSERT_EQ(irs::type<irs::by_term>::name(), irs::string_ref(and_node.children[2]->name)); // excluded
+  for (auto& child : and_node.children) {
+    ASSERT_EQ(1, child->executions.load());
+  }
+
+  auto& or_node = *and_node.children[1];
+  ASSERT_EQ(2, or_node.children.size());
+  ASSERT_EQ(6, or_node.children[0]->docs.load());
+  ASSERT_EQ(7, or_node.children[1]->docs.load());
+  ASSERT_EQ(0, or_node.children[0]->children.size());
+  ASSERT_EQ(0, or_node.children[1]->children.size());
+
+  // depth-first visitation
+  std::vector<std::pair<std::string, size_t>> visited;
+  profile.visit([&visited](const irs::query_profile::node& node, size_t depth) {
+    visited.emplace_back(node.name, depth);
+    return true;
+  });
+  ASSERT_EQ(7, visited.size());
+  ASSERT_EQ(0, visited[0].second);
+  ASSERT_EQ(1, visited[1].second);
+  ASSERT_EQ(2, visited[2].second);
+  ASSERT_EQ(2, visited[3].second);
+  ASSERT_EQ(3, visited[4].second);
+  ASSERT_EQ(3, visited[5].second);
+  ASSERT_EQ(2, visited[6].second);
+
+  std::stringstream out;
+  out << profile;
+  ASSERT_FALSE(out.str().empty());
+
+  // profiling doesn't affect the result
+  check_query(root, expected, rdr);
+}
+
+TEST_P(query_profile_test_case, profile_batches) {
+  {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      &tests::generic_json_field_factory);
+    add_segment(gen);
+  }
+
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr->size());
+  auto& segment = (*rdr)[0];
+
+  // profiled postings keep the conjunction intersecting blocks
+  irs::And root;
+  append<irs::by_term>(root, "same", "xyz");
+  append<irs::by_term>(root, "duplicated", "abcd");
+
+  irs::query_profile profile;
+  auto prepared = profile.prepare(root, *rdr, irs::order::prepared::unordered());
+  ASSERT_NE(nullptr, prepared);
+
+  {
+    docs_t actual;
+    auto it = prepared->execute(segment, irs::order::prepared::unordered(), &profile);
+    while (it->next()) {
+      actual.push_back(it->value());
+    }
+    ASSERT_EQ((docs_t{ 1, 5, 11, 21, 27, 31 }), actual);
+  }
+
+  auto& and_node = *profile.root().children.front();
+  ASSERT_EQ(2, and_node.children.size());
+  uint64_t batches = 0;
+  for (auto& child : and_node.children) {
+    batches += child->batches.load();
+    ASSERT_EQ(0, child->nexts.load());
+  }
+  ASSERT_LT(0, batches);
+
+  std::stringstream out;
+  out << profile;
+  ASSERT_NE(std::string::npos, out.str().find("batches="));
+}
+
+TEST_P(query_profile_test_case, plan) {
+  {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      &tests::generic_json_field_factory);
+    add_segment(gen);
+  }
+
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr->size());
+  docs_t docs;
+
+  // dense disjunction is materialized
+  {
+    irs::Or root;
+    append<irs::by_term>(root, "duplicated", "abcd");
+    append<irs::by_term>(root, "duplicated", "vczc");
+    append<irs::by_term>(root, "name", "A");
+
+    irs::query_profile profile;
+    auto& stats = plans(profile, root, *rdr, docs);
+    ASSERT_EQ(1, stats[irs::PlanType::BITSET]);
+    ASSERT_EQ(0, stats[irs::PlanType::MERGE]);
+
+    // same result as merging on the fly
+    irs::Or merged;
+    {
+      auto& sub = merged.add<irs::Or>();
+      append<irs::by_term>(sub, "duplicated", "abcd");
+      append<irs::by_term>(sub, "duplicated", "vczc");
+    }
+    append<irs::by_term>(merged, "name", "A");
+
+    docs_t expected;
+    irs::query_profile merged_profile;
+    ASSERT_EQ(1, plans(merged_profile, merged, *rdr, expected)[irs::PlanType::MERGE]);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(expected, docs);
+
+    std::stringstream out;
+    out << profile;
+    ASSERT_NE(std::string::npos, out.str().find("plan=bitset:1"));
+  }
+
+  // conjunction, 'all' is pruned without scoring
+  {
+    irs::And root;
+    append<irs::by_term>(root, "same", "xyz");
+    append<irs::by_term>(root, "duplicated", "abcd");
+    root.add<irs::all>();
+
+    irs::query_profile profile;
+    auto& stats = plans(profile, root, *rdr, docs);
+    ASSERT_EQ(1, stats[irs::PlanType::LEAPFROG]);
+    ASSERT_EQ(6, docs.size());
+
+    auto& and_node = *profile.root().children.front();
+    ASSERT_EQ(3, and_node.children.size());
+    ASSERT_EQ(irs::type<irs::all>::name(), irs::string_ref(and_node.children[2]->name));
+    ASSERT_EQ(0, and_node.children[2]->executions.load());
+  }
+
+  // empty conjunction
+  {
+    irs::And root;
+    append<irs::by_term>(root, "same", "xyz");
+    append<irs::by_term>(root, "duplicated", "invalid");
+
+    irs::query_profile profile;
+    ASSERT_EQ(1, plans(profile, root, *rdr, docs)[irs::PlanType::EMPTY]);
+    ASSERT_TRUE(docs.empty());
+  }
+
+  // dense disjunction nested into a selective conjunction is merged
+  {
+    irs::And root;
+    append<irs::by_term>(root, "name", "B");
+    {
+      auto& sub = root.add<irs::Or>();
+      append<irs::by_term>(sub, "duplicated", "abcd");
+      append<irs::by_term>(sub, "duplicated", "vczc");
+      append<irs::by_term>(sub, "same", "xyz");
+    }
+
+    irs::query_profile profile;
+    ASSERT_EQ(1, plans(profile, root, *rdr, docs)[irs::PlanType::LEAPFROG]);
+    ASSERT_EQ((docs_t{ 2 }), docs);
+
+    auto& or_node = *profile.root().children.front()->children[1];
+    ASSERT_EQ(1, or_node.executions.load());
+    ASSERT_EQ(1, or_node.plans[irs::PlanType::MERGE]);
+    ASSERT_EQ(0, or_node.plans[irs::PlanType::BITSET]);
+  }
+
+  // dense disjunction nested into a dense conjunction is materialized
+  {
+    irs::And root;
+    append<irs::by_term>(root, "same", "xyz");
+    {
+      auto& sub = root.add<irs::Or>();
+      append<irs::by_term>(sub, "duplicated", "abcd");
+      append<irs::by_term>(sub, "name", "B");
+      append<irs::by_term>(sub, "name", "C");
+    }
+
+    irs::query_profile profile;
+    plans(profile, root, *rdr, docs);
+    ASSERT_EQ((docs_t{ 1, 2, 3, 5, 11, 21, 27, 31 }), docs);
+
+    // executed once again as soon as the lead cost is known
+    auto& or_node = *profile.root().children.front()->children[1];
+    ASSERT_EQ(2, or_node.executions.load());
+    ASSERT_EQ(1, or_node.plans[irs::PlanType::BITSET]);
+  }
+
+  // dense disjunction excluded from a selective conjunction is merged
+  {
+    irs::And root;
+    append<irs::by_term>(root, "name", "B");
+    {
+      auto& sub = root.add<irs::Not>().filter<irs::Or>();
+      append<irs::by_term>(sub, "duplicated", "abcd");
+      append<irs::by_term>(sub, "name", "A");
+      append<irs::by_term>(sub, "name", "C");
+    }
+
+    irs::query_profile profile;
+    plans(profile, root, *rdr, docs);
+    ASSERT_EQ((docs_t{ 2 }), docs);
+
+    auto& or_node = *profile.root().children.front()->children[1];
+    ASSERT_EQ(1, or_node.plans[irs::PlanType::MERGE]);
+    ASSERT_EQ(0, or_node.plans[irs::PlanType::BITSET]);
+  }
+
+  // dense disjunction excluded from a dense conjunction is materialized
+  {
+    irs::And root;
+    append<irs::by_term>(root, "same", "xyz");
+    {
+      auto& sub = root.add<irs::Not>().filter<irs::Or>();
+      append<irs::by_term>(sub, "duplicated", "abcd");
+      append<irs::by_term>(sub, "name", "A");
+      append<irs::by_term>(sub, "name", "C");
+    }
+
+    irs::query_profile profile;
+    plans(profile, root, *rdr, docs);
+    ASSERT_EQ(32 - 7, docs.size());
+
+    auto& or_node = *profile.root().children.front()->children[1];
+    ASSERT_EQ(1, or_node.plans[irs::PlanType::BITSET]);
+  }
+
+  // multi-term queries
+  {
+    auto make_prefix = [](irs::string_ref field, irs::string_ref term) {
+      irs::by_prefix filter;
+      *filter.mutable_field() = field;
+      filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(term);
+      return filter;
+    };
+
+    irs::query_profile dense; // 'abcd', 'abcde', 'abcdrer'
+    ASSERT_EQ(1, plans(dense, make_prefix("prefix", "abcd"), *rdr, docs)[irs::PlanType::BITSET]);
+    ASSERT_EQ(3, docs.size());
+
+    irs::query_profile few; // 'bateradsfsfasdf', 'bcd'
+    ASSERT_EQ(1, plans(few, make_prefix("prefix", "b"), *rdr, docs)[irs::PlanType::MERGE]);
+    ASSERT_EQ((docs_t{ 9, 24 }), docs);
+
+    irs::query_profile single; // 'abde'
+    ASSERT_EQ(1, plans(single, make_prefix("prefix", "abd"), *rdr, docs)[irs::PlanType::SINGLE]);
+    ASSERT_EQ(1, docs.size());
+  }
+}
+
+TEST_P(query_profile_test_case, plan_many_terms) {
+  // 1/32 of the segment is 128 documents
+  {
+    auto writer = open_writer(irs::OM_CREATE);
+    {
+      auto ctx = writer->documents();
+      char id[5];
+
+      for (size_t i = 0; i < 4096; ++i) {
+        std::snprintf(id, sizeof id, "%04u", unsigned(i));
+        tests::templates::string_field field("id", id);
+        ASSERT_TRUE(ctx.insert().insert<irs::Action::INDEX>(field));
+      }
+    }
+    ASSERT_TRUE(writer->commit());
+  }
+
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr->size());
+  ASSERT_EQ(4096, rdr->docs_count());
+  docs_t docs;
+
+  auto make_prefix = [](irs::string_ref field, irs::string_ref term) {
+    irs::by_prefix filter;
+    *filter.mutable_field() = field;
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(term);
+    return filter;
+  };
+
+  // a few sparse terms are merged on the fly, '0000'..'0009'
+  {
+    irs::query_profile profile;
+    ASSERT_EQ(1, plans(profile, make_prefix("id", "000"), *rdr, docs)[irs::PlanType::MERGE]);
+    ASSERT_EQ(10, docs.size());
+  }
+
+  // many sparse terms are unioned into a bitset, '0000'..'0099'
+  {
+    irs::query_profile profile;
+    auto& stats = plans(profile, make_prefix("id", "00"), *rdr, docs);
+    ASSERT_EQ(1, stats[irs::PlanType::BITSET]);
+    ASSERT_EQ(0, stats[irs::PlanType::MERGE]);
+    ASSERT_EQ(100, docs.size());
+  }
+}
+
+TEST(query_profile_test, forward_parent_attributes) {
+  struct context final : irs::attribute_provider {
+    irs::attribute* get_mutable(irs::type_info::type_id type) noexcept override {
+      return irs::type<irs::document>::id() == type ? &doc : nullptr;
+    }
+
+    irs::document doc;
+  } ctx;
+
+  irs::query_profile profile;
+  ASSERT_EQ(&profile, irs::get<irs::query_profile>(profile));
+  ASSERT_EQ(nullptr, irs::get<irs::document>(profile));
+
+  irs::And root;
+  auto prepared = profile.prepare(root, irs::sub_reader::empty(),
+                                  irs::order::prepared::unordered(), &ctx);
+  ASSERT_NE(nullptr, prepared);
+  ASSERT_EQ(&ctx.doc, irs::get<irs::document>(profile));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  query_profile_test,
+  query_profile_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory,
+      &tests::mmap_directory
+    ),
+    ::testing::Values("1_0")
+  ),
+  tests::to_string
+);
+
+}
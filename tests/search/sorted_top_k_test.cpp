@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "filter_test_case_base.hpp"
+#include "index/comparer.hpp"
+#include "search/all_filter.hpp"
+#include "search/sorted_top_k.hpp"
+#include "search/term_filter.hpp"
+
+namespace {
+
+// ascending order of string values, documents without a value go last
+struct string_comparer final : irs::comparer {
+  virtual bool less(const irs::bytes_ref& lhs, const irs::bytes_ref& rhs) const override {
+    if (rhs.null()) {
+      return !lhs.null();
+    } else if (lhs.null()) {
+      return false;
+    }
+
+    return irs::to_string<irs::string_ref>(lhs.c_str())
+      < irs::to_string<irs::string_ref>(rhs.c_str());
+  }
+};
+
+class sorted_top_k_test_case : public tests::filter_test_case_base {
+ protected:
+  // documents are sorted by 'prefix' + 'name'
+  void add_sorted_segment(const std::string& prefix) {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      [&prefix](tests::document& doc,
+                const std::string& name,
+                const tests::json_doc_generator::json_value& data) {
+        if (!data.is_string()) {
+          return;
+        }
+
+        doc.insert(std::make_shared<tests::templates::string_field>(name, data.str));
+
+        if (name == "name") {
+          doc.sorted = std::make_shared<tests::templates::string_field>(
+            "sort", prefix + static_cast<std::string>(data.str));
+        }
+    });
+
+    irs::index_writer::init_options opts;
+    opts.comparator = &less_;
+    add_segment(gen, irs::OM_CREATE | irs::OM_APPEND, opts);
+  }
+
+  // exhaustive execution of a query used as a reference
+  irs::sorted_docs execute(
+      const irs::filter::prepared& query,
+      const irs::index_reader& rdr,
+      size_t limit) const {
+    irs::sorted_docs docs;
+
+    for (size_t i = 0; i < rdr.size(); ++i) {
+      auto& segment = rdr[i];
+      auto* column = segment.sort();
+      EXPECT_NE(nullptr, column);
+      auto values = column->values();
+      irs::bytes_ref value;
+
+      for (auto it = segment.mask(query.execute(segment)); it->next(); ) {
+        EXPECT_TRUE(values(it->value(), value));
+        docs.push_back({ irs::bstring(value.c_str(), value.size()), true, i, it->value() });
+      }
+    }
+
+    std::sort(docs.begin(), docs.end(),
+              [this](const irs::sorted_doc& lhs, const irs::sorted_doc& rhs) {
+      if (less_(lhs.value(), rhs.value())) {
+        return true;
+      }
+
+      if (less_(rhs.value(), lhs.value())) {
+        return false;
+      }
+
+      return std::make_pair(lhs.segment, lhs.doc) < std::make_pair(rhs.segment, rhs.doc);
+    });
+
+    docs.resize(std::min(limit, docs.size()));
+
+    return docs;
+  }
+
+  void assert_top_k(
+      const irs::filter& filter,
+      const irs::index_reader& rdr,
+      size_t limit,
+      size_t max_visited) const {
+    auto prepared = filter.prepare(rdr);
+    ASSERT_NE(nullptr, prepared);
+
+    const auto expected = execute(*prepared, rdr, limit);
+
+    irs::sorted_docs actual;
+    const size_t visited = irs::sorted_top_k(*prepared, rdr, less_, limit, actual);
+    ASSERT_GE(max_visited, visited);
+    ASSERT_EQ(expected.size(), actual.size());
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(expected[i].segment, actual[i].segment);
+      ASSERT_EQ(expected[i].doc, actual[i].doc);
+      ASSERT_EQ(expected[i].key, actual[i].key);
+      ASSERT_TRUE(actual[i].has_key);
+    }
+  }
+
+  string_comparer less_;
+};
+
+irs::by_term make_filter(const irs::string_ref& field, const irs::string_ref& term) {
+  irs::by_term filter;
+  *filter.mutable_field() = field;
+  filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(term);
+  return filter;
+}
+
+TEST_P(sorted_top_k_test_case, early_termination) {
+  add_sorted_segment("");
+  add_sorted_segment("");
+
+  auto rdr = open_reader();
+  ASSERT_EQ(2, rdr.size());
+
+  // every document matches, a segment is abandoned
+  // right after the first match not getting into the result
+  for (size_t limit : { 1, 5, 10, 32 }) {
+    assert_top_k(irs::all(), rdr, limit, 2*(limit + 1));
+    assert_top_k(make_filter("same", "xyz"), rdr, limit, 2*(limit + 1));
+  }
+
+  // 'duplicated' == 'abcd' for 6 documents of each segment
+  assert_top_k(make_filter("duplicated", "abcd"), rdr, 3, 8);
+  assert_top_k(make_filter("duplicated", "abcd"), rdr, 100, 12);
+
+  // no matches
+  assert_top_k(make_filter("same", "invalid"), rdr, 10, 0);
+
+  // zero limit
+  {
+    irs::sorted_docs docs;
+    auto prepared = irs::all().prepare(rdr);
+    ASSERT_EQ(0, irs::sorted_top_k(*prepared, rdr, less_, 0, docs));
+    ASSERT_TRUE(docs.empty());
+  }
+}
+
+TEST_P(sorted_top_k_test_case, skip_segments) {
+  add_sorted_segment("~"); // every value is greater than any of the segment below
+  add_sorted_segment("");
+  add_sorted_segment("");
+
+  auto rdr = open_reader();
+  ASSERT_EQ(3, rdr.size());
+
+  // segments are visited in order of their least values,
+  // the first segment is never visited
+  assert_top_k(irs::all(), rdr, 5, 2*(5 + 1));
+  assert_top_k(make_filter("duplicated", "abcd"), rdr, 2, 2*(2 + 1));
+
+  // the first segment is required to fill the result
+  assert_top_k(irs::all(), rdr, 70, 3*32);
+}
+
+TEST_P(sorted_top_k_test_case, removed_docs) {
+  add_sorted_segment("");
+  add_sorted_segment("");
+
+  // remove documents having the least values and 'duplicated' == 'abcd'
+  {
+    const auto a = make_filter("name", "A");
+    const auto b = make_filter("name", "B");
+    const auto duplicated = make_filter("duplicated", "abcd");
+
+    irs::index_writer::init_options opts;
+    opts.comparator = &less_;
+    auto writer = open_writer(irs::OM_APPEND, opts);
+    writer->documents().remove(a);
+    writer->documents().remove(b);
+    writer->documents().remove(duplicated);
+    ASSERT_TRUE(writer->commit());
+  }
+
+  auto rdr = open_reader();
+  ASSERT_EQ(2, rdr.size());
+
+  for (size_t limit : { 1, 5, 100 }) {
+    assert_top_k(irs::all(), rdr, limit, 2*32);
+    assert_top_k(make_filter("same", "xyz"), rdr, limit, 2*32);
+
+    irs::sorted_docs docs;
+    auto prepared = irs::all().prepare(rdr);
+    irs::sorted_top_k(*prepared, rdr, less_, limit, docs);
+    ASSERT_EQ(std::min(limit, size_t(rdr.live_docs_count())), docs.size());
+
+    for (auto& doc : docs) {
+      ASSERT_TRUE(rdr[doc.segment].live(doc.doc));
+    }
+  }
+
+  // every matching document is removed
+  assert_top_k(make_filter("duplicated", "abcd"), rdr, 10, 0);
+  {
+    irs::sorted_docs docs;
+    auto prepared = make_filter("duplicated", "abcd").prepare(rdr);
+    ASSERT_EQ(0, irs::sorted_top_k(*prepared, rdr, less_, 10, docs));
+    ASSERT_TRUE(docs.empty());
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  sorted_top_k_test,
+  sorted_top_k_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory
+    ),
+    ::testing::Values("1_0", "1_4")
+  ),
+  tests::to_string
+);
+
+}
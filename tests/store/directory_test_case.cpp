@@ -1340,6 +1340,38 @@ TEST_P(directory_test_case, directory_size) {
   }
 }
 
+TEST_P(directory_test_case, sync_files) {
+  constexpr size_t count = 100;
+  std::vector<std::string> names;
+
+  for (size_t i = 0; i < count; ++i) {
+    names.emplace_back("sync" + std::to_string(i));
+    auto out = dir_->create(names.back());
+    ASSERT_NE(nullptr, out);
+    out->write_vint(uint32_t(i));
+  }
+
+  std::vector<std::reference_wrapper<const std::string>> files(names.begin(), names.end());
+
+  ASSERT_TRUE(dir_->sync_files({}));
+  ASSERT_TRUE(dir_->sync_files({ files.data(), 1 }));
+  ASSERT_TRUE(dir_->sync_files({ files.data(), files.size() }));
+
+  // contents are intact
+  for (size_t i = 0; i < count; ++i) {
+    auto in = dir_->open(names[i], irs::IOAdvice::NORMAL);
+    ASSERT_NE(nullptr, in);
+    ASSERT_EQ(i, in->read_vint());
+  }
+
+  // missing file
+  if (dynamic_cast<irs::fs_directory*>(dir_.get())) {
+    const std::string missing = "missing";
+    files.emplace(files.begin() + count/2, missing);
+    ASSERT_FALSE(dir_->sync_files({ files.data(), files.size() }));
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
   directory_test,
   directory_test_case,
@@ -1587,6 +1619,50 @@ TEST_F(fs_directory_test, utf8_chars_native) {
   }
 }
 
+TEST_F(fs_directory_test, copy) {
+  const std::string data(3 * 65536 + 17, 'x');
+  memory_directory mem_dir;
+
+  {
+    auto out = mem_dir.create("src");
+    ASSERT_NE(nullptr, out);
+    out->write_bytes(reinterpret_cast<const byte_type*>(data.c_str()), data.size());
+  }
+
+  auto check = [&data](const directory& dir, const std::string& name) {
+    auto in = dir.open(name, IOAdvice::NORMAL);
+    ASSERT_NE(nullptr, in);
+    ASSERT_EQ(data.size(), in->length());
+    std::string actual(data.size(), '\0');
+    ASSERT_EQ(data.size(), in->read_bytes(reinterpret_cast<byte_type*>(&actual[0]), actual.size()));
+    ASSERT_EQ(data, actual);
+  };
+
+  // memory -> fs
+  ASSERT_TRUE(directory_utils::copy(mem_dir, "src", *dir_, "copy0"));
+  check(*dir_, "copy0");
+
+  // fs -> fs, transferred within the kernel
+  auto path = test_case_dir();
+  path /= "other";
+  ASSERT_TRUE(path.mkdir(false));
+  fs_directory other_dir(path.utf8());
+  ASSERT_TRUE(directory_utils::copy(*dir_, "copy0", other_dir, "copy1"));
+  check(other_dir, "copy1");
+
+  // existing file is overwritten
+  ASSERT_TRUE(directory_utils::copy(*dir_, "copy0", other_dir, "copy1"));
+  check(other_dir, "copy1");
+
+  // fs -> memory
+  ASSERT_TRUE(directory_utils::copy(other_dir, "copy1", mem_dir, "copy2"));
+  check(mem_dir, "copy2");
+
+  // missing file
+  ASSERT_FALSE(directory_utils::copy(*dir_, "missing", other_dir, "copy3"));
+  ASSERT_FALSE(directory_utils::copy(mem_dir, "missing", other_dir, "copy3"));
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                 fs_directory_test
 // -----------------------------------------------------------------------------
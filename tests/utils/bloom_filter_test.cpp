@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "store/memory_directory.hpp"
+#include "utils/bloom_filter.hpp"
+
+namespace {
+
+std::string key(size_t i) {
+  return "key_" + std::to_string(i);
+}
+
+irs::bytes_ref bytes(const std::string& str) {
+  return irs::ref_cast<irs::byte_type>(irs::string_ref(str));
+}
+
+}
+
+TEST(bloom_filter_test, empty) {
+  irs::bloom_filter filter;
+  ASSERT_TRUE(filter.empty());
+}
+
+TEST(bloom_filter_test, hash) {
+  // hash is persisted, must be stable
+  ASSERT_EQ(irs::bloom_filter::hash(bytes("key")), irs::bloom_filter::hash(bytes("key")));
+  ASSERT_NE(irs::bloom_filter::hash(bytes("key")), irs::bloom_filter::hash(bytes("kez")));
+}
+
+TEST(bloom_filter_test, insert_find) {
+  constexpr size_t NUM_KEYS = 10000;
+
+  irs::bloom_filter filter(NUM_KEYS);
+  ASSERT_FALSE(filter.empty());
+
+  for (size_t i = 0; i < NUM_KEYS; ++i) {
+    filter.insert(bytes(key(i)));
+  }
+
+  // no false negatives
+  for (size_t i = 0; i < NUM_KEYS; ++i) {
+    ASSERT_TRUE(filter.may_contain(bytes(key(i))));
+  }
+
+  // ~1% false positives expected for 10 bits per key
+  size_t false_positives = 0;
+  for (size_t i = NUM_KEYS; i < 2*NUM_KEYS; ++i) {
+    false_positives += size_t(filter.may_contain(bytes(key(i))));
+  }
+  ASSERT_LT(false_positives, NUM_KEYS / 50);
+}
+
+TEST(bloom_filter_test, read_write) {
+  constexpr size_t NUM_KEYS = 1000;
+
+  irs::bloom_filter filter(NUM_KEYS);
+  for (size_t i = 0; i < NUM_KEYS; ++i) {
+    filter.insert(bytes(key(i)));
+  }
+
+  irs::memory_output out(irs::memory_allocator::global());
+  filter.write(out.stream);
+  out.stream.flush();
+
+  irs::memory_index_input in(out.file);
+  irs::bloom_filter read;
+  read.read(in);
+  ASSERT_FALSE(read.empty());
+
+  for (size_t i = 0; i < 2*NUM_KEYS; ++i) {
+    ASSERT_EQ(filter.may_contain(bytes(key(i))), read.may_contain(bytes(key(i))));
+  }
+}
+
+TEST(bloom_filter_test, read_invalid) {
+  irs::memory_output out(irs::memory_allocator::global());
+  out.stream.write_vint(0); // no probes
+  out.stream.write_vlong(1);
+  out.stream.flush();
+
+  irs::memory_index_input in(out.file);
+  irs::bloom_filter filter;
+  ASSERT_THROW(filter.read(in), irs::index_error);
+  ASSERT_TRUE(filter.empty());
+}
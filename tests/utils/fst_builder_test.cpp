@@ -160,6 +160,47 @@ void assert_fst_read_write(const std::string& resource) {
     }
   }
 
+  // read fst referencing weights in place
+  {
+    irs::bstring buf(out.file.length(), 0);
+    in.seek(0);
+    ASSERT_EQ(buf.size(), in.read_bytes(&buf[0], buf.size()));
+
+    irs::bytes_ref_input buf_in(buf);
+    std::unique_ptr<irs::immutable_byte_fst> mapped_fst(irs::immutable_byte_fst::Read(buf_in, true));
+    ASSERT_NE(nullptr, mapped_fst);
+    ASSERT_EQ(buf.size(), buf_in.file_pointer());
+    ASSERT_EQ(read_fst->NumStates(), mapped_fst->NumStates());
+    ASSERT_EQ(read_fst->Start(), mapped_fst->Start());
+
+    auto assert_in_place = [&buf](const irs::bytes_ref& weight) {
+      if (!weight.empty()) {
+        ASSERT_LE(buf.c_str(), weight.c_str());
+        ASSERT_LE(weight.c_str() + weight.size(), buf.c_str() + buf.size());
+      }
+    };
+
+    for (fst::StateIterator<irs::immutable_byte_fst> it(*read_fst); !it.Done(); it.Next()) {
+      const auto s = it.Value();
+      ASSERT_EQ(read_fst->NumArcs(s), mapped_fst->NumArcs(s));
+      ASSERT_EQ(static_cast<irs::bytes_ref>(read_fst->Final(s)),
+                static_cast<irs::bytes_ref>(mapped_fst->Final(s)));
+      assert_in_place(static_cast<irs::bytes_ref>(mapped_fst->Final(s)));
+
+      fst::ArcIterator<irs::immutable_byte_fst> expected_arcs(*read_fst, s);
+      fst::ArcIterator<irs::immutable_byte_fst> actual_arcs(*mapped_fst, s);
+      for (; !expected_arcs.Done(); expected_arcs.Next(), actual_arcs.Next()) {
+        auto& expected_arc = expected_arcs.Value();
+        auto& actual_arc = actual_arcs.Value();
+        ASSERT_EQ(expected_arc.ilabel, actual_arc.ilabel);
+        ASSERT_EQ(expected_arc.nextstate, actual_arc.nextstate);
+        ASSERT_EQ(static_cast<irs::bytes_ref>(expected_arc.weight),
+                  static_cast<irs::bytes_ref>(actual_arc.weight));
+        assert_in_place(static_cast<irs::bytes_ref>(actual_arc.weight));
+      }
+    }
+  }
+
   // check fst
   {
     using sorted_matcher_t = fst::SortedMatcher<irs::immutable_byte_fst>;
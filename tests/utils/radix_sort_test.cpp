@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+#include "index/comparer.hpp"
+#include "utils/radix_sort.hpp"
+
+namespace {
+
+using entry = std::pair<irs::bstring, size_t>; // key, original position
+
+std::vector<entry> make_entries(const std::vector<std::string>& keys) {
+  std::vector<entry> entries;
+  for (auto& key : keys) {
+    entries.emplace_back(irs::ref_cast<irs::byte_type>(irs::string_ref(key)),
+                         entries.size());
+  }
+  return entries;
+}
+
+void assert_sorted(std::vector<entry> entries) {
+  auto expected = entries;
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const entry& lhs, const entry& rhs) {
+    return irs::bytes_ref(lhs.first) < irs::bytes_ref(rhs.first);
+  });
+
+  irs::msd_radix_sort(entries, [](const entry& e) noexcept {
+    return irs::bytes_ref(e.first);
+  });
+
+  ASSERT_EQ(expected, entries);
+}
+
+}
+
+TEST(radix_sort_test, empty) {
+  assert_sorted({});
+  assert_sorted(make_entries({ "" }));
+  assert_sorted(make_entries({ "", "" }));
+}
+
+TEST(radix_sort_test, small) {
+  assert_sorted(make_entries({ "b", "a", "", "ab", "a", "ba", "" }));
+}
+
+TEST(radix_sort_test, prefixes) {
+  // long common prefixes, exhausted keys, duplicates
+  std::vector<std::string> keys;
+  for (size_t i = 0; i < 1000; ++i) {
+    keys.emplace_back(std::string(i % 50, 'x') + std::to_string(i % 7));
+    keys.emplace_back(std::string(i % 50, 'x'));
+  }
+  assert_sorted(make_entries(keys));
+}
+
+TEST(radix_sort_test, random) {
+  std::mt19937 rnd(42);
+  std::uniform_int_distribution<size_t> length(0, 16);
+  std::uniform_int_distribution<int> byte(0, 255);
+
+  for (size_t size : { 10, 31, 32, 33, 100, 10000 }) {
+    std::vector<entry> entries;
+    for (size_t i = 0; i < size; ++i) {
+      irs::bstring key(length(rnd), 0);
+      for (auto& b : key) {
+        b = irs::byte_type(byte(rnd) % 4); // lots of shared prefixes
+      }
+      entries.emplace_back(std::move(key), i);
+    }
+    assert_sorted(std::move(entries));
+  }
+}
+
+TEST(radix_sort_test, memcmp_comparer) {
+  const irs::memcmp_comparer less;
+  ASSERT_TRUE(less.has_normalizer());
+
+  const irs::bstring values[] {
+    irs::bstring(), irs::bstring(1, 0), irs::bstring(1, 1),
+    irs::bstring(2, 0), irs::bstring(1, 255)
+  };
+
+  // order of normalized keys must match the order of a comparer
+  auto normalize = [&less](const irs::bytes_ref& value) {
+    irs::bstring key;
+    less.normalize(value, key);
+    return key;
+  };
+
+  for (auto& lhs : values) {
+    for (auto& rhs : values) {
+      ASSERT_EQ(less(lhs, rhs),
+                irs::bytes_ref(normalize(lhs)) < irs::bytes_ref(normalize(rhs)));
+    }
+
+    // nil goes first
+    ASSERT_TRUE(less(irs::bytes_ref::NIL, lhs));
+    ASSERT_FALSE(less(lhs, irs::bytes_ref::NIL));
+    ASSERT_TRUE(irs::bytes_ref(normalize(irs::bytes_ref::NIL))
+                  < irs::bytes_ref(normalize(lhs)));
+  }
+}
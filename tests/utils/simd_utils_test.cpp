@@ -201,3 +201,56 @@ TEST(simd_utils_test, maxbits) {
     ASSERT_EQ(irs::packed::maxbits64(max), irs::simd::maxbits<true>(values, IRESEARCH_COUNTOF(values)));
   }
 }
+
+TEST(simd_utils_test, intersect) {
+  auto expected_intersection = [](const std::vector<uint32_t>& lhs,
+                                  const std::vector<uint32_t>& rhs) {
+    std::vector<uint32_t> out;
+    std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                          std::back_inserter(out));
+    return out;
+  };
+
+  auto intersect = [](const std::vector<uint32_t>& lhs,
+                      const std::vector<uint32_t>& rhs) {
+    std::vector<uint32_t> out(lhs.size());
+    out.resize(irs::simd::intersect(lhs.data(), lhs.size(),
+                                    rhs.data(), rhs.size(),
+                                    out.data()));
+    return out;
+  };
+
+  // empty
+  ASSERT_TRUE(intersect({}, {}).empty());
+  ASSERT_TRUE(intersect({ 1, 2, 3 }, {}).empty());
+  ASSERT_TRUE(intersect({}, { 1, 2, 3 }).empty());
+
+  std::vector<uint32_t> lhs, rhs;
+  for (uint32_t i = 1; i < 1000; ++i) {
+    if (0 == i % 3) {
+      lhs.push_back(i);
+    }
+    if (0 == i % 5 || 0 == i % 7) {
+      rhs.push_back(i);
+    }
+  }
+
+  ASSERT_EQ(expected_intersection(lhs, rhs), intersect(lhs, rhs));
+  ASSERT_EQ(expected_intersection(rhs, lhs), intersect(rhs, lhs));
+  ASSERT_EQ(lhs, intersect(lhs, lhs));
+
+  // skewed
+  const std::vector<uint32_t> skewed{ 3, 500, 501, 999, 5000 };
+  ASSERT_EQ(expected_intersection(skewed, rhs), intersect(skewed, rhs));
+  ASSERT_EQ(expected_intersection(rhs, skewed), intersect(rhs, skewed));
+
+  // in place
+  {
+    auto expected = expected_intersection(lhs, rhs);
+    auto actual = lhs;
+    actual.resize(irs::simd::intersect(actual.data(), actual.size(),
+                                       rhs.data(), rhs.size(),
+                                       actual.data()));
+    ASSERT_EQ(expected, actual);
+  }
+}
@@ -35,8 +35,12 @@
 #pragma warning(default: 4101)
 #endif
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <memory>
+#include <mutex>
 
 #if defined(_MSC_VER)
 #pragma warning(disable: 4229)
@@ -57,6 +61,7 @@
 #include "store/store_utils.hpp"
 #include "utils/directory_utils.hpp"
 #include "utils/index_utils.hpp"
+#include "utils/math_utils.hpp"
 #include "utils/string_utils.hpp"
 #include "utils/text_format.hpp"
 
@@ -80,12 +85,20 @@ const std::string ANALYZER_TYPE = "analyzer-type";
 const std::string ANALYZER_OPTIONS = "analyzer-options";
 const std::string SEGMENT_MEM_MAX = "segment-memory-max";
 const std::string CONSOLIDATION_INTERVAL = "consolidation-interval";
+const std::string CONSOLIDATION_POLICY = "consolidation-policy";
+const std::string CONSOLIDATION_THRESHOLD = "consolidation-threshold";
+const std::string SEGMENT_DOCS_MAX = "segment-docs-max";
+const std::string STATS = "stats";
+const std::string STATS_INTERVAL = "stats-interval";
 
 const std::string DEFAULT_ANALYZER_TYPE = "segmentation";
 const std::string DEFAULT_ANALYZER_OPTIONS = R"({})";
 
 constexpr size_t DEFAULT_SEGMENT_MEM_MAX = 1 << 28; // 256M
 constexpr size_t DEFAULT_CONSOLIDATION_INTERVAL_MSEC = 500;
+constexpr size_t DEFAULT_STATS_INTERVAL_MSEC = 1000;
+
+const std::string DEFAULT_CONSOLIDATION_POLICY = "tier";
 
 constexpr irs::IndexFeatures TEXT_INDEX_FEATURES =
   irs::IndexFeatures::FREQ | irs::IndexFeatures::POS;
@@ -101,6 +114,304 @@ constexpr std::array<irs::type_info::type_id, 1> LEGACY_TEXT_FEATURES{ irs::type
 constexpr std::array<irs::type_info::type_id, 1> TEXT_FEATURES{ irs::type<irs::norm2>::id()  };
 constexpr std::array<irs::type_info::type_id, 1> NUMERIC_FEATURES{ irs::type<irs::granularity_prefix>::id() };
 
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  ingestion stats
+// -----------------------------------------------------------------------------
+
+using steady_clock = std::chrono::steady_clock;
+
+uint64_t to_usec(steady_clock::duration duration) noexcept {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class latency_histogram
+/// @brief thread-safe histogram of latencies with power of 2 buckets,
+///        i.e. bucket 'i' accounts for latencies in [2^i, 2^(i+1)) usec
+////////////////////////////////////////////////////////////////////////////////
+class latency_histogram {
+ public:
+  static constexpr size_t NUM_BUCKETS = 40;
+
+  void add(steady_clock::duration duration) {
+    const auto usec = to_usec(duration);
+    const size_t bucket = std::min(
+      size_t(irs::math::math_traits<uint64_t>::bits_required(usec)),
+      NUM_BUCKETS) - size_t(usec != 0);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++buckets_[bucket];
+    ++count_;
+    sum_ += usec;
+    max_ = std::max(max_, usec);
+  }
+
+  void write_json(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    out << "{ \"count\": " << count_
+        << ", \"sum_us\": " << sum_
+        << ", \"max_us\": " << max_
+        << ", \"buckets_us\": {";
+
+    bool first = true;
+    for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+      if (buckets_[i]) {
+        out << (first ? " " : ", ") << '"' << (uint64_t(1) << i) << "\": " << buckets_[i];
+        first = false;
+      }
+    }
+
+    out << " } }";
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::array<uint64_t, NUM_BUCKETS> buckets_{};
+  uint64_t count_{};
+  uint64_t sum_{};
+  uint64_t max_{};
+}; // latency_histogram
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct ingestion_stats
+////////////////////////////////////////////////////////////////////////////////
+struct ingestion_stats {
+  explicit ingestion_stats(size_t interval_ms) noexcept
+    : interval_ms(interval_ms) {
+  }
+
+  const size_t interval_ms;
+  const steady_clock::time_point start{steady_clock::now()};
+  std::atomic<uint64_t> docs{}; // number of indexed documents
+  std::atomic<uint64_t> parse_ns{}; // time spent parsing input lines
+  std::atomic<uint64_t> analysis_ns{}; // time spent in analyzers
+  std::atomic<uint64_t> insert_ns{}; // time spent inserting documents, including analysis
+  std::atomic<uint64_t> bytes_synced{}; // number of bytes written to a directory
+  std::atomic<uint64_t> consolidations{}; // number of successfully consolidated segments
+  latency_histogram flush; // index_writer::begin()
+  latency_histogram commit; // index_writer::commit() after begin()
+  latency_histogram consolidation; // index_writer::consolidate(...)
+  std::mutex samples_mutex;
+  std::vector<std::pair<uint64_t, uint64_t>> samples; // <elapsed msec, docs>
+
+  void sample() {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock(samples_mutex);
+    samples.emplace_back(elapsed, docs.load());
+  }
+}; // ingestion_stats
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class counting_directory
+/// @brief accounts sizes of files synced by an index_writer, every file
+///        is synced exactly once so the total is equal to bytes written
+////////////////////////////////////////////////////////////////////////////////
+class counting_directory final : public irs::directory {
+ public:
+  counting_directory(irs::directory& impl, std::atomic<uint64_t>& bytes) noexcept
+    : impl_(impl), bytes_(bytes) {
+  }
+
+  using directory::attributes;
+  virtual irs::attribute_store& attributes() noexcept override {
+    return impl_.attributes();
+  }
+
+  virtual irs::index_output::ptr create(const std::string& name) noexcept override {
+    return impl_.create(name);
+  }
+
+  virtual bool exists(bool& result, const std::string& name) const noexcept override {
+    return impl_.exists(result, name);
+  }
+
+  virtual bool length(uint64_t& result, const std::string& name) const noexcept override {
+    return impl_.length(result, name);
+  }
+
+  virtual irs::index_lock::ptr make_lock(const std::string& name) noexcept override {
+    return impl_.make_lock(name);
+  }
+
+  virtual bool mtime(std::time_t& result, const std::string& name) const noexcept override {
+    return impl_.mtime(result, name);
+  }
+
+  virtual irs::index_input::ptr open(
+      const std::string& name,
+      irs::IOAdvice advice) const noexcept override {
+    return impl_.open(name, advice);
+  }
+
+  virtual bool remove(const std::string& name) noexcept override {
+    return impl_.remove(name);
+  }
+
+  virtual bool rename(const std::string& src, const std::string& dst) noexcept override {
+    return impl_.rename(src, dst);
+  }
+
+  virtual bool sync(const std::string& name) noexcept override {
+    uint64_t size;
+    if (impl_.length(size, name)) {
+      bytes_ += size;
+    }
+
+    return impl_.sync(name);
+  }
+
+  virtual bool sync_files(
+      irs::range<const std::reference_wrapper<const std::string>> files) noexcept override {
+    for (auto& file : files) {
+      uint64_t size;
+      if (impl_.length(size, file)) {
+        bytes_ += size;
+      }
+    }
+
+    // keep the batched path of the underlying directory
+    return impl_.sync_files(files);
+  }
+
+  virtual bool visit(const visitor_f& visitor) const override {
+    return impl_.visit(visitor);
+  }
+
+ private:
+  irs::directory& impl_;
+  std::atomic<uint64_t>& bytes_;
+}; // counting_directory
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class timed_token_stream
+/// @brief accumulates time spent in 'next()' of the underlying stream
+////////////////////////////////////////////////////////////////////////////////
+class timed_token_stream final : public irs::token_stream {
+ public:
+  void reset(irs::token_stream& impl, std::atomic<uint64_t>& ns) noexcept {
+    impl_ = &impl;
+    ns_ = &ns;
+  }
+
+  virtual irs::attribute* get_mutable(irs::type_info::type_id type) override {
+    return impl_->get_mutable(type);
+  }
+
+  virtual bool next() override {
+    const auto start = steady_clock::now();
+    const bool res = impl_->next();
+    *ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+      steady_clock::now() - start).count();
+    return res;
+  }
+
+ private:
+  irs::token_stream* impl_{};
+  std::atomic<uint64_t>* ns_{};
+}; // timed_token_stream
+
+std::string json_escape(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+
+  for (const char c : value) {
+    if ('"' == c || '\\' == c) {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+
+  return escaped;
+}
+
+void write_stats(
+    std::ostream& out,
+    const std::vector<std::pair<std::string, std::string>>& config,
+    ingestion_stats& stats,
+    uint64_t total_ms,
+    uint64_t index_bytes) {
+  const auto docs = stats.docs.load();
+
+  out << "{\n  \"config\": {";
+  for (size_t i = 0; i < config.size(); ++i) {
+    out << (i ? "," : "") << "\n    \"" << json_escape(config[i].first)
+        << "\": \"" << json_escape(config[i].second) << "\"";
+  }
+  out << "\n  },\n";
+
+  out << "  \"docs\": " << docs << ",\n"
+      << "  \"total_ms\": " << total_ms << ",\n"
+      << "  \"docs_per_sec\": " << (total_ms ? docs * 1000. / total_ms : 0.) << ",\n"
+      << "  \"time_ms\": {"
+      << " \"parse\": " << stats.parse_ns.load() / 1000000
+      << ", \"analysis\": " << stats.analysis_ns.load() / 1000000
+      << ", \"inversion\": " << (stats.insert_ns.load() - std::min(stats.insert_ns.load(), stats.analysis_ns.load())) / 1000000
+      << " },\n"
+      << "  \"index_bytes\": " << index_bytes << ",\n"
+      << "  \"bytes_written\": " << stats.bytes_synced.load() << ",\n"
+      << "  \"bytes_per_doc\": " << (docs ? double(index_bytes) / docs : 0.) << ",\n"
+      << "  \"write_amplification\": " << (index_bytes ? double(stats.bytes_synced.load()) / index_bytes : 0.) << ",\n"
+      << "  \"consolidated_segments\": " << stats.consolidations.load() << ",\n";
+
+  out << "  \"flush\": ";
+  stats.flush.write_json(out);
+  out << ",\n  \"commit\": ";
+  stats.commit.write_json(out);
+  out << ",\n  \"consolidation\": ";
+  stats.consolidation.write_json(out);
+
+  out << ",\n  \"throughput\": [";
+  {
+    std::lock_guard<std::mutex> lock(stats.samples_mutex);
+    std::pair<uint64_t, uint64_t> prev{0, 0};
+    for (size_t i = 0; i < stats.samples.size(); ++i) {
+      auto& sample = stats.samples[i];
+      const auto elapsed = sample.first - prev.first;
+
+      out << (i ? "," : "") << "\n    { \"elapsed_ms\": " << sample.first
+          << ", \"docs\": " << sample.second
+          << ", \"docs_per_sec\": " << (elapsed ? (sample.second - prev.second) * 1000. / elapsed : 0.)
+          << " }";
+      prev = sample;
+    }
+  }
+  out << "\n  ]\n}\n";
+}
+
+irs::index_writer::consolidation_policy_t make_consolidation_policy(
+    const std::string& name,
+    float threshold) {
+  if (name == "tier") {
+    return irs::index_utils::consolidation_policy(irs::index_utils::consolidate_tier());
+  } else if (name == "bytes") {
+    irs::index_utils::consolidate_bytes opts;
+    opts.threshold = threshold;
+    return irs::index_utils::consolidation_policy(opts);
+  } else if (name == "bytes_accum") {
+    irs::index_utils::consolidate_bytes_accum opts;
+    opts.threshold = threshold;
+    return irs::index_utils::consolidation_policy(opts);
+  } else if (name == "count") {
+    irs::index_utils::consolidate_count opts;
+    opts.threshold = threshold > 0.f ? size_t(threshold) : opts.threshold;
+    return irs::index_utils::consolidation_policy(opts);
+  } else if (name == "docs_live") {
+    irs::index_utils::consolidate_docs_live opts;
+    opts.threshold = threshold;
+    return irs::index_utils::consolidation_policy(opts);
+  } else if (name == "docs_fill") {
+    irs::index_utils::consolidate_docs_fill opts;
+    opts.threshold = threshold;
+    return irs::index_utils::consolidation_policy(opts);
+  }
+
+  return nullptr;
+}
+
 }
 
 struct Doc {
@@ -205,6 +516,8 @@ struct Doc {
   struct TextField : public Field {
     std::string f;
     mutable irs::analysis::analyzer::ptr stream;
+    mutable timed_token_stream timed_stream;
+    std::atomic<uint64_t>* analysis_ns{}; // accumulate analysis time if set
 
     TextField(
         const irs::string_ref& n,
@@ -217,6 +530,12 @@ struct Doc {
 
     irs::token_stream& get_tokens() const override {
       stream->reset(f);
+
+      if (analysis_ns) {
+        timed_stream.reset(*stream, *analysis_ns);
+        return timed_stream;
+      }
+
       return *stream;
     }
 
@@ -272,7 +591,10 @@ std::atomic<uint64_t> Doc::next_id(0);
 using analyzer_factory_f = std::function<irs::analysis::analyzer::ptr()>;
 
 struct WikiDoc : Doc {
-  explicit WikiDoc(const analyzer_factory_f& analyzer_factory, const irs::features_t& text_features) {
+  explicit WikiDoc(
+      const analyzer_factory_f& analyzer_factory,
+      const irs::features_t& text_features,
+      std::atomic<uint64_t>* analysis_ns = nullptr) {
     // id
     id = std::make_shared<StringField>("id", irs::IndexFeatures::NONE, irs::features_t{});
     elements.emplace_back(id);
@@ -298,6 +620,7 @@ struct WikiDoc : Doc {
       "body", TEXT_INDEX_FEATURES,
       text_features,
       analyzer_factory());
+    body->analysis_ns = analysis_ns;
     elements.push_back(body);
   }
 
@@ -335,6 +658,14 @@ struct WikiDoc : Doc {
   std::shared_ptr<TextField> body;
 };
 
+struct ingestion_options_t {
+  std::string consolidation_policy{DEFAULT_CONSOLIDATION_POLICY};
+  float consolidation_threshold{};
+  size_t segment_docs_max{};
+  std::string stats; // path to a JSON report, empty == no stats
+  size_t stats_interval_ms{DEFAULT_STATS_INTERVAL_MSEC};
+};
+
 int put(
     const std::string& path,
     const std::string& dir_type,
@@ -349,7 +680,8 @@ int put(
     size_t consolidation_interval_ms,
     size_t batch_size,
     size_t segment_mem_max,
-    bool consolidate_all) {
+    bool consolidate_all,
+    const ingestion_options_t& ingestion) {
   auto dir = create_directory(dir_type, path);
 
   if (!dir) {
@@ -397,13 +729,57 @@ int put(
   opts.features[irs::type<irs::norm>::id()] = &irs::norm::compute;
   opts.segment_pool_size = indexer_threads;
   opts.segment_memory_max = segment_mem_max;
+  opts.segment_docs_max = ingestion.segment_docs_max;
   opts.feature_column_info = [](irs::type_info::type_id) {
     return irs::column_info{ irs::type<irs::compression::none>::get(), {}, false };
   };
 
-  auto writer = irs::index_writer::make(*dir, codec, irs::OM_CREATE, opts);
+  auto policy = make_consolidation_policy(
+    ingestion.consolidation_policy, ingestion.consolidation_threshold);
+
+  if (!policy) {
+    std::cerr << "Unknown consolidation policy '" << ingestion.consolidation_policy << "'" << std::endl;
+    return 1;
+  }
+
+  std::fstream stats_out;
+  std::unique_ptr<ingestion_stats> stats;
+  std::unique_ptr<counting_directory> counting_dir;
+  irs::directory* writer_dir = dir.get();
+
+  if (!ingestion.stats.empty()) {
+    stats_out.open(ingestion.stats, std::fstream::out | std::fstream::trunc);
+
+    if (!stats_out) {
+      std::cerr << "Unable to open stats file '" << ingestion.stats << "'" << std::endl;
+      return 1;
+    }
+
+    stats = irs::memory::make_unique<ingestion_stats>(ingestion.stats_interval_ms);
+    counting_dir = irs::memory::make_unique<counting_directory>(*dir, stats->bytes_synced);
+    writer_dir = counting_dir.get();
+  }
+
+  auto writer = irs::index_writer::make(*writer_dir, codec, irs::OM_CREATE, opts);
+
+  // split commit into flush and sync phases if stats are requested
+  auto commit = [&writer, &stats]() {
+    if (!stats) {
+      writer->commit();
+      return;
+    }
+
+    auto start = steady_clock::now();
+    writer->begin();
+    stats->flush.add(steady_clock::now() - start);
 
-  irs::async_utils::thread_pool thread_pool(indexer_threads + consolidation_threads + 1); // +1 for commiter thread
+    start = steady_clock::now();
+    writer->commit();
+    stats->commit.add(steady_clock::now() - start);
+  };
+
+  irs::async_utils::thread_pool thread_pool(
+    indexer_threads + consolidation_threads + 1 + size_t(bool(stats))); // +1 for commiter thread, +1 for stats sampler
 
   SCOPED_TIMER("Total Time");
   std::cout << "Configuration:\n"
@@ -419,7 +795,12 @@ int put(
             << CONSOLIDATE_ALL << "=" << consolidate_all << '\n'
             << ANALYZER_TYPE << "=" << analyzer_type << '\n'
             << ANALYZER_OPTIONS << "=" << analyzer_options << '\n'
-            << SEGMENT_MEM_MAX << "=" << segment_mem_max << '\n';
+            << SEGMENT_MEM_MAX << "=" << segment_mem_max << '\n'
+            << SEGMENT_DOCS_MAX << "=" << ingestion.segment_docs_max << '\n'
+            << CONSOLIDATION_POLICY << "=" << ingestion.consolidation_policy << '\n'
+            << CONSOLIDATION_THRESHOLD << "=" << ingestion.consolidation_threshold << '\n'
+            << STATS << "=" << ingestion.stats << '\n'
+            << STATS_INTERVAL << "=" << ingestion.stats_interval_ms << '\n';
 
   struct {
     std::condition_variable cond_;
@@ -487,12 +868,12 @@ int put(
 
   // commiter thread
   if (commit_interval_ms) {
-    thread_pool.run([&consolidation_cv, &consolidation_mutex, &batch_provider, commit_interval_ms, &writer, consolidation_threads]()->void {
+    thread_pool.run([&consolidation_cv, &consolidation_mutex, &batch_provider, commit_interval_ms, &commit, consolidation_threads]()->void {
       while (!batch_provider.done_.load()) {
         {
           SCOPED_TIMER("Commit time");
           std::cout << "COMMIT" << std::endl; // break indexer thread output by commit
-          writer->commit();
+          commit();
         }
 
         // notify consolidation threads
@@ -506,12 +887,19 @@ int put(
     });
   }
 
-  // consolidation threads
-  const irs::index_utils::consolidate_tier consolidation_options;
-  auto policy = irs::index_utils::consolidation_policy(consolidation_options);
+  // stats sampler thread
+  if (stats) {
+    thread_pool.run([&batch_provider, &stats]()->void {
+      while (!batch_provider.done_.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(stats->interval_ms));
+        stats->sample();
+      }
+    });
+  }
 
+  // consolidation threads
   for (size_t i = consolidation_threads; i; --i) {
-    thread_pool.run([&dir, &policy, &batch_provider, &consolidation_mutex, &consolidation_cv, consolidation_interval_ms, &writer]()->void {
+    thread_pool.run([&dir, &policy, &batch_provider, &consolidation_mutex, &consolidation_cv, consolidation_interval_ms, &writer, &stats]()->void {
       while (!batch_provider.done_.load()) {
         {
           auto lock = irs::make_unique_lock(consolidation_mutex);
@@ -523,7 +911,16 @@ int put(
 
         {
           SCOPED_TIMER("Consolidation time");
-          writer->consolidate(policy);
+          const auto start = steady_clock::now();
+          const auto res = writer->consolidate(policy);
+
+          if (stats) {
+            stats->consolidation.add(steady_clock::now() - start);
+
+            if (res) {
+              stats->consolidations += res.size;
+            }
+          }
         }
 
         {
@@ -536,19 +933,23 @@ int put(
 
   // indexer threads
   for (size_t i = indexer_threads; i; --i) {
-    thread_pool.run([text_features, &analyzer_factory, &batch_provider, &writer](){
+    thread_pool.run([text_features, &analyzer_factory, &batch_provider, &writer, &stats](){
       std::vector<std::string> buf;
-      WikiDoc doc(analyzer_factory, text_features);
+      WikiDoc doc(analyzer_factory, text_features, stats ? &stats->analysis_ns : nullptr);
 
       while (batch_provider.swap(buf)) {
         SCOPED_TIMER(std::string("Index batch ") + std::to_string(buf.size()));
         auto ctx = writer->documents();
+        steady_clock::duration parse_time{};
+        steady_clock::duration insert_time{};
         size_t i = 0;
 
         do {
           auto builder = ctx.insert();
 
+          const auto start = steady_clock::now();
           doc.fill(&(buf[i]));
+          const auto parsed = steady_clock::now();
 
           for (auto& field: doc.elements) {
             builder.insert<irs::Action::INDEX>(*field);
@@ -558,8 +959,16 @@ int put(
             builder.insert<irs::Action::STORE>(*field);
           }
 
+          parse_time += parsed - start;
+          insert_time += steady_clock::now() - parsed;
         } while (++i < buf.size());
 
+        if (stats) {
+          stats->parse_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(parse_time).count();
+          stats->insert_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(insert_time).count();
+          stats->docs += buf.size();
+        }
+
         std::cout << "." << std::flush; // newline in commit thread
       }
     });
@@ -570,21 +979,64 @@ int put(
   {
     SCOPED_TIMER("Commit time");
     std::cout << "COMMIT" << std::endl; // break indexer thread output by commit
-    writer->commit();
+    commit();
   }
 
   if (consolidate_all) {
     // merge all segments into a single segment
     SCOPED_TIMER("Consolidating all time");
     std::cout << "Consolidating all segments:" << std::endl;
-    writer->consolidate(irs::index_utils::consolidation_policy(irs::index_utils::consolidate_count()));
-    writer->commit();
+    const auto start = steady_clock::now();
+    const auto res = writer->consolidate(irs::index_utils::consolidation_policy(irs::index_utils::consolidate_count()));
+
+    if (stats) {
+      stats->consolidation.add(steady_clock::now() - start);
+
+      if (res) {
+        stats->consolidations += res.size;
+      }
+    }
+
+    commit();
   }
 
   if (consolidate_all || consolidation_threads) {
     irs::directory_utils::remove_all_unreferenced(*dir);
   }
 
+  if (stats) {
+    const auto total_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+      steady_clock::now() - stats->start).count();
+    stats->sample();
+
+    uint64_t index_bytes = 0;
+    dir->visit([&dir, &index_bytes](std::string& name) {
+      uint64_t size;
+      if (dir->length(size, name)) {
+        index_bytes += size;
+      }
+      return true;
+    });
+
+    const std::vector<std::pair<std::string, std::string>> config {
+      { INDEX_DIR, path },
+      { DIR_TYPE, dir_type },
+      { FORMAT, format },
+      { THR, std::to_string(indexer_threads) },
+      { CONS_THR, std::to_string(consolidation_threads) },
+      { CPR, std::to_string(commit_interval_ms) },
+      { CONSOLIDATION_INTERVAL, std::to_string(consolidation_interval_ms) },
+      { CONSOLIDATION_POLICY, ingestion.consolidation_policy },
+      { CONSOLIDATION_THRESHOLD, std::to_string(ingestion.consolidation_threshold) },
+      { BATCH_SIZE, std::to_string(batch_size) },
+      { SEGMENT_MEM_MAX, std::to_string(segment_mem_max) },
+      { SEGMENT_DOCS_MAX, std::to_string(ingestion.segment_docs_max) },
+      { ANALYZER_TYPE, analyzer_type },
+      { CONSOLIDATE_ALL, consolidate_all ? "true" : "false" } };
+
+    write_stats(stats_out, config, *stats, total_ms, index_bytes);
+  }
+
   u_cleanup();
 
   return 0;
@@ -622,6 +1074,23 @@ int put(const cmdline::parser& args) {
     ? args.get<size_t>(CONSOLIDATION_INTERVAL)
     : DEFAULT_CONSOLIDATION_INTERVAL_MSEC;
 
+  ingestion_options_t ingestion;
+  if (args.exist(CONSOLIDATION_POLICY)) {
+    ingestion.consolidation_policy = args.get<std::string>(CONSOLIDATION_POLICY);
+  }
+  if (args.exist(CONSOLIDATION_THRESHOLD)) {
+    ingestion.consolidation_threshold = args.get<float>(CONSOLIDATION_THRESHOLD);
+  }
+  if (args.exist(SEGMENT_DOCS_MAX)) {
+    ingestion.segment_docs_max = args.get<size_t>(SEGMENT_DOCS_MAX);
+  }
+  if (args.exist(STATS)) {
+    ingestion.stats = args.get<std::string>(STATS);
+  }
+  if (args.exist(STATS_INTERVAL)) {
+    ingestion.stats_interval_ms = args.get<size_t>(STATS_INTERVAL);
+  }
+
   std::fstream fin;
   std::istream* in;
   if (args.exist(INPUT)) {
@@ -640,7 +1109,7 @@ int put(const cmdline::parser& args) {
   return put(path, dir_type, format, analyzer_type, analyzer_options,
              *in, lines_max, indexer_threads, consolidation_threads,
              commit_interval_ms, consolidation_internval_ms,
-             batch_size, segment_mem_max, consolidate);
+             batch_size, segment_mem_max, consolidate, ingestion);
 }
 
 int put(int argc, char* argv[]) {
@@ -661,6 +1130,11 @@ int put(int argc, char* argv[]) {
   cmdput.add(ANALYZER_TYPE, 0, "Text analyzer type", false, DEFAULT_ANALYZER_TYPE);
   cmdput.add(ANALYZER_OPTIONS, 0, "Text analyzer options", false, DEFAULT_ANALYZER_OPTIONS);
   cmdput.add(SEGMENT_MEM_MAX, 0, "Max size of per-segment in-memory buffer", false, DEFAULT_SEGMENT_MEM_MAX);
+  cmdput.add(SEGMENT_DOCS_MAX, 0, "Max number of documents per segment", false, size_t(0));
+  cmdput.add(CONSOLIDATION_POLICY, 0, "Consolidation policy (tier|bytes|bytes_accum|count|docs_live|docs_fill)", false, DEFAULT_CONSOLIDATION_POLICY);
+  cmdput.add(CONSOLIDATION_THRESHOLD, 0, "Consolidation policy threshold", false, 0.f);
+  cmdput.add(STATS, 0, "Output file for ingestion statistics (JSON)", false, std::string());
+  cmdput.add(STATS_INTERVAL, 0, "Throughput sampling interval (msec)", false, DEFAULT_STATS_INTERVAL_MSEC);
 
   cmdput.parse(argc, argv);
 
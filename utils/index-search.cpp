@@ -33,7 +33,11 @@
   #pragma warning(default: 4101)
 #endif
 
+#include <atomic>
+#include <cmath>
 #include <fstream>
+#include <iomanip>
+#include <numeric>
 #include <random>
 #include <thread>
 
@@ -61,8 +65,10 @@
 #include "search/wildcard_filter.hpp"
 #include "search/ngram_similarity_filter.hpp"
 #include "store/fs_directory.hpp"
+#include "utils/file_utils.hpp"
 #include "utils/memory_pool.hpp"
 #include "utils/levenshtein_default_pdp.hpp"
+#include "utils/utf8_path.hpp"
 
 #include "index-search.hpp"
 
@@ -99,6 +105,10 @@ const std::string SCORER_ARG = "scorer-arg";
 const std::string SCORER_ARG_FMT = "scorer-arg-format";
 const std::string DIR_TYPE = "dir-type";
 const std::string FORMAT = "format";
+const std::string BENCHMARK = "benchmark";
+const std::string CONCURRENCY = "concurrency";
+const std::string WARMUP = "warmup";
+const std::string COLD = "cold";
 
 }
 
@@ -399,6 +409,66 @@ irs::filter::prepared::ptr prepareFilter(
   }
 }
 
+using scored_doc_t = std::pair<float_t, irs::doc_id_t>;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief executes a specified query against every segment of a reader and
+///        collects up to 'limit' top scored documents into 'sorted'
+/// @returns number of matched documents
+////////////////////////////////////////////////////////////////////////////////
+size_t executeFilter(
+    const irs::filter::prepared& filter,
+    const irs::directory_reader& reader,
+    const irs::order::prepared& order,
+    size_t limit,
+    std::vector<scored_doc_t>& sorted) {
+  auto less = [](const scored_doc_t& lhs, const scored_doc_t& rhs) noexcept {
+    return lhs.first < rhs.first;
+  };
+
+  size_t doc_count = 0;
+  sorted.clear();
+
+  for (auto& segment: reader) {
+    auto docs = filter.execute(segment, order); // query segment
+    const irs::score* score = irs::get<irs::score>(*docs);
+    assert(score);
+    const irs::document* doc = irs::get<irs::document>(*docs);
+    assert(doc);
+
+    while (docs->next()) {
+      ++doc_count;
+      const float_t score_value = *reinterpret_cast<const float_t*>(score->evaluate());
+
+      if (sorted.size() < limit) {
+        sorted.emplace_back(score_value, doc->value);
+        std::push_heap(sorted.begin(), sorted.end(), less);
+      } else if (sorted.front().first < score_value) {
+        std::pop_heap(sorted.begin(), sorted.end(), less);
+
+        auto& back = sorted.back();
+        back.first = score_value;
+        back.second = doc->value;
+
+        std::push_heap(sorted.begin(), sorted.end(), less);
+      }
+    }
+  }
+
+  auto end = sorted.end();
+  for (auto begin = sorted.begin(); begin != end; --end) {
+    std::pop_heap(begin, end, less);
+  }
+
+  return doc_count;
+}
+
+irs::analysis::analyzer::ptr makeAnalyzer() {
+  static const std::string analyzer_name("text");
+  static const std::string analyzer_args("{\"locale\":\"en\", \"stopwords\":[\"abc\", \"def\", \"ghi\"]}"); // from index-put
+  return irs::analysis::analyzers::get(analyzer_name, irs::type<irs::text_format::json>::get(), analyzer_args);
+}
+
 void prepareTasks(std::vector<task_t>& buf, std::istream& in, size_t tasks_per_category) {
   std::map<category_t, size_t> category_counts;
   std::string tmpBuf;
@@ -421,6 +491,293 @@ void prepareTasks(std::vector<task_t>& buf, std::istream& in, size_t tasks_per_c
   }
 }
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    benchmark mode
+// -----------------------------------------------------------------------------
+
+struct benchmark_options_t {
+  std::vector<size_t> concurrency; // number of search threads per run
+  size_t warmup{}; // number of warm-up passes before a measured warm run
+  bool cold{}; // do a cold-cache run before warm-up
+};
+
+struct run_stats_t {
+  category_t category{category_t::UNKNOWN};
+  size_t concurrency{};
+  bool cold{};
+  size_t queries{}; // number of executed queries
+  size_t failed{}; // number of queries failed to prepare
+  size_t hits{}; // total number of matched documents
+  double seconds{}; // wall-clock duration of a run
+  std::vector<uint64_t> latencies; // per-query latency in usec, ascending
+
+  // nearest-rank percentile, 'p' is in range [0..1]
+  uint64_t percentile(double p) const noexcept {
+    if (latencies.empty()) {
+      return 0;
+    }
+
+    const auto rank = static_cast<size_t>(std::ceil(p * latencies.size()));
+    return latencies[std::min(std::max(rank, size_t(1)), latencies.size()) - 1];
+  }
+
+  double mean() const noexcept {
+    return latencies.empty()
+      ? 0.
+      : std::accumulate(latencies.begin(), latencies.end(), 0.) / latencies.size();
+  }
+
+  double qps() const noexcept {
+    return seconds > 0. ? queries / seconds : 0.;
+  }
+};
+
+std::vector<size_t> parseConcurrency(const std::string& value) {
+  std::vector<size_t> levels;
+  std::string tmpBuf;
+
+  for (std::istringstream in(value); std::getline(in, tmpBuf, ',');) {
+    const auto level = std::stoull(tmpBuf);
+
+    if (level) {
+      levels.emplace_back(level);
+    }
+  }
+
+  return levels;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief evicts index files from the OS page cache, reader must be closed
+///        beforehand since pages mapped by an 'mmap_directory' are not evicted
+/// @note has no effect on platforms without 'posix_fadvise'
+////////////////////////////////////////////////////////////////////////////////
+bool dropPageCache(const std::string& path, const irs::directory& dir) {
+  return dir.visit([&path](std::string& name) {
+    irs::utf8_path file(path);
+    file /= name;
+
+    // opening a file with 'DONTNEED' advice drops its cached pages
+    irs::file_utils::open(file.c_str(), irs::file_utils::OpenMode::Read, IR_FADVICE_DONTNEED);
+    return true;
+  });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief executes every task 'repeat' times using 'concurrency' threads
+////////////////////////////////////////////////////////////////////////////////
+run_stats_t runTasks(
+    const irs::directory_reader& reader,
+    const irs::order::prepared& order,
+    const std::vector<const task_t*>& tasks,
+    size_t repeat,
+    size_t concurrency,
+    size_t limit,
+    size_t scored_terms_limit) {
+  struct thread_stats_t {
+    size_t failed{};
+    size_t hits{};
+    std::vector<uint64_t> latencies;
+  };
+
+  const size_t total = tasks.size()*repeat;
+  std::atomic<size_t> next{0};
+  std::vector<thread_stats_t> thread_stats(concurrency);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  {
+    irs::async_utils::thread_pool thread_pool(concurrency);
+
+    for (auto& stats : thread_stats) {
+      stats.latencies.reserve(total / concurrency + 1);
+
+      thread_pool.run([&stats, &next, &tasks, &reader, &order, total, limit, scored_terms_limit]()->void {
+        auto analyzer = makeAnalyzer();
+        std::string tmpBuf;
+        std::vector<scored_doc_t> sorted;
+        sorted.reserve(limit);
+
+        for (size_t i; (i = next++) < total;) {
+          const auto& task = *tasks[i % tasks.size()];
+          const auto begin = std::chrono::steady_clock::now();
+
+          auto filter = prepareFilter(reader, order, task.category, task.text, analyzer, tmpBuf, scored_terms_limit);
+
+          if (!filter) {
+            ++stats.failed;
+            continue;
+          }
+
+          stats.hits += executeFilter(*filter, reader, order, limit, sorted);
+          stats.latencies.emplace_back(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - begin).count());
+        }
+      });
+    }
+
+    thread_pool.stop();
+  }
+
+  run_stats_t run;
+  run.concurrency = concurrency;
+  run.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  for (auto& stats : thread_stats) {
+    run.failed += stats.failed;
+    run.hits += stats.hits;
+    run.latencies.insert(run.latencies.end(), stats.latencies.begin(), stats.latencies.end());
+  }
+
+  run.queries = run.latencies.size();
+  std::sort(run.latencies.begin(), run.latencies.end());
+
+  return run;
+}
+
+std::string jsonEscape(const irs::string_ref& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+
+  for (const char c : value) {
+    switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\r': escaped += "\\r"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[7];
+          std::snprintf(buf, sizeof buf, "\\u%04x", c);
+          escaped += buf;
+        } else {
+          escaped += c;
+        }
+    }
+  }
+
+  return escaped;
+}
+
+void writeJson(
+    std::ostream& out,
+    const std::vector<std::pair<std::string, std::string>>& config,
+    const irs::directory_reader& reader,
+    const std::vector<run_stats_t>& runs) {
+  out << "{\n  \"config\": {";
+  for (size_t i = 0; i < config.size(); ++i) {
+    out << (i ? "," : "") << "\n    \"" << jsonEscape(config[i].first)
+        << "\": \"" << jsonEscape(config[i].second) << "\"";
+  }
+  out << "\n  },\n";
+
+  out << "  \"index\": {"
+      << " \"segments\": " << reader.size()
+      << ", \"docs\": " << reader->docs_count()
+      << ", \"live_docs\": " << reader->live_docs_count() << " },\n";
+
+  out << "  \"runs\": [";
+  for (size_t i = 0; i < runs.size(); ++i) {
+    auto& run = runs[i];
+
+    out << (i ? "," : "") << "\n    {"
+        << " \"category\": \"" << stringCategory(run.category) << "\""
+        << ", \"concurrency\": " << run.concurrency
+        << ", \"cache\": \"" << (run.cold ? "cold" : "warm") << "\""
+        << ", \"queries\": " << run.queries
+        << ", \"failed\": " << run.failed
+        << ", \"hits\": " << run.hits
+        << ", \"seconds\": " << run.seconds
+        << ", \"qps\": " << run.qps()
+        << ", \"latency_us\": {"
+        << " \"min\": " << run.percentile(0.)
+        << ", \"mean\": " << run.mean()
+        << ", \"p50\": " << run.percentile(0.5)
+        << ", \"p90\": " << run.percentile(0.9)
+        << ", \"p99\": " << run.percentile(0.99)
+        << ", \"p999\": " << run.percentile(0.999)
+        << ", \"max\": " << (run.latencies.empty() ? 0 : run.latencies.back())
+        << " } }";
+  }
+  out << "\n  ]\n}\n";
+}
+
+int benchmark(
+    const benchmark_options_t& opts,
+    const std::string& path,
+    const irs::directory& dir,
+    const irs::format::ptr& codec,
+    irs::directory_reader& reader,
+    const irs::order::prepared& order,
+    std::vector<task_t>&& tasks,
+    size_t repeat,
+    size_t limit,
+    size_t scored_terms_limit,
+    const std::vector<std::pair<std::string, std::string>>& config,
+    std::ostream& out) {
+  // group tasks by category
+  std::map<category_t, std::vector<const task_t*>> categories;
+  for (auto& task : tasks) {
+    if (category_t::UNKNOWN != task.category) {
+      categories[task.category].emplace_back(&task);
+    }
+  }
+
+  std::vector<run_stats_t> runs;
+
+  auto report = [&runs](run_stats_t&& run) {
+    std::cout << std::left << std::setw(20) << stringCategory(run.category)
+              << std::right
+              << " threads=" << std::setw(3) << run.concurrency
+              << " cache=" << (run.cold ? "cold" : "warm")
+              << " queries=" << std::setw(6) << run.queries
+              << " qps=" << std::setw(10) << std::fixed << std::setprecision(1) << run.qps()
+              << " p50=" << std::setw(8) << run.percentile(0.5)
+              << " p90=" << std::setw(8) << run.percentile(0.9)
+              << " p99=" << std::setw(8) << run.percentile(0.99)
+              << " p999=" << std::setw(8) << run.percentile(0.999)
+              << " usec\n";
+    runs.emplace_back(std::move(run));
+  };
+
+  for (const auto concurrency : opts.concurrency) {
+    for (auto& entry : categories) {
+      auto& category_tasks = entry.second;
+
+      if (opts.cold) {
+        reader = irs::directory_reader(); // release mapped and opened files
+
+        if (!dropPageCache(path, dir)) {
+          std::cerr << "Failed to drop page cache for index at '" << path << "'" << std::endl;
+          return 1;
+        }
+
+        reader = irs::directory_reader::open(dir, codec);
+
+        // every task is executed exactly once, otherwise the run gets warm
+        auto run = runTasks(reader, order, category_tasks, 1, concurrency, limit, scored_terms_limit);
+        run.category = entry.first;
+        run.cold = true;
+        report(std::move(run));
+      }
+
+      for (size_t i = 0; i < opts.warmup; ++i) {
+        runTasks(reader, order, category_tasks, 1, concurrency, limit, scored_terms_limit);
+      }
+
+      auto run = runTasks(reader, order, category_tasks, repeat, concurrency, limit, scored_terms_limit);
+      run.category = entry.first;
+      report(std::move(run));
+    }
+  }
+
+  writeJson(out, config, reader, runs);
+
+  return 0;
+}
+
 int search(
     const std::string& path,
     const std::string& dir_type,
@@ -436,7 +793,8 @@ int search(
     size_t scored_terms_limit,
     const std::string& scorer,
     const std::string& scorer_arg_format,
-    const irs::string_ref& scorer_arg) {
+    const irs::string_ref& scorer_arg,
+    const benchmark_options_t* bench) {
   // build parametric descriptions for distances 1 and 2
   irs::default_pdp(1, false); irs::default_pdp(1, true);
   irs::default_pdp(2, false); irs::default_pdp(2, true);
@@ -518,6 +876,39 @@ int search(
     order = sort.prepare();
   }
 
+  if (bench) {
+    std::vector<task_t> tasks;
+    prepareTasks(tasks, in, tasks_max);
+
+    std::string concurrency;
+    for (auto level : bench->concurrency) {
+      concurrency += (concurrency.empty() ? "" : ",") + std::to_string(level);
+    }
+
+    const std::vector<std::pair<std::string, std::string>> config {
+      { INDEX_DIR, path },
+      { DIR_TYPE, dir_type },
+      { FORMAT, format },
+      { MAX, std::to_string(tasks_max) },
+      { RPT, std::to_string(repeat) },
+      { WARMUP, std::to_string(bench->warmup) },
+      { COLD, std::to_string(bench->cold) },
+      { CONCURRENCY, concurrency },
+      { TOPN, std::to_string(limit) },
+      { SCORED_TERMS_LIMIT, std::to_string(scored_terms_limit) },
+      { SCORER, scorer },
+      { SCORER_ARG_FMT, scorer_arg_format },
+      { SCORER_ARG, static_cast<std::string>(scorer_arg) }
+    };
+
+    const int res = benchmark(*bench, path, *dir, codec, reader, order,
+                              std::move(tasks), repeat, limit,
+                              scored_terms_limit, config, out);
+    u_cleanup();
+
+    return res;
+  }
+
   struct task_provider_t {
     typedef irs::concurrent_stack<size_t> freelist_t;
 
@@ -592,15 +983,13 @@ int search(
   // indexer threads
   for (size_t i = search_threads; i; --i) {
     thread_pool.run([&task_provider, &reader, &order, limit, &out, csv, scored_terms_limit]()->void {
-      static const std::string analyzer_name("text");
-      static const std::string analyzer_args("{\"locale\":\"en\", \"stopwords\":[\"abc\", \"def\", \"ghi\"]}"); // from index-put
-      auto analyzer = irs::analysis::analyzers::get(analyzer_name, irs::type<irs::text_format::json>::get(), analyzer_args);
+      auto analyzer = makeAnalyzer();
       irs::filter::prepared::ptr filter;
       std::string tmpBuf;
       const timers_t building_timers("building");
       const timers_t execution_timers("execution");
 
-      std::vector<std::pair<float_t, irs::doc_id_t>> sorted;
+      std::vector<scored_doc_t> sorted;
       sorted.reserve(limit);
 
       // process a single task
@@ -613,8 +1002,6 @@ int search(
         size_t doc_count = 0;
         const auto start = std::chrono::system_clock::now();
 
-        sorted.clear();
-
         // parse task
         {
           irs::timer_utils::scoped_timer timer(*(building_timers.stat[size_t(task->category)]));
@@ -628,58 +1015,7 @@ int search(
         // execute task
         {
           irs::timer_utils::scoped_timer timer(*(execution_timers.stat[size_t(task->category)]));
-
-          for (auto& segment: reader) {
-            auto docs = filter->execute(segment, order); // query segment
-            const irs::score* score = irs::get<irs::score>(*docs);
-            assert(score);
-            const irs::document* doc = irs::get<irs::document>(*docs);
-            assert(doc);
-
-            while (docs->next()) {
-              ++doc_count;
-              const float_t score_value = *reinterpret_cast<const float_t*>(score->evaluate());
-
-              if (sorted.size() < limit) {
-                sorted.emplace_back(score_value, doc->value);
-
-                std::push_heap(
-                  sorted.begin(), sorted.end(),
-                  [](const std::pair<float_t, irs::doc_id_t>& lhs,
-                     const std::pair<float_t, irs::doc_id_t>& rhs) noexcept {
-                    return lhs.first < rhs.first;
-                });
-              } else if (sorted.front().first < score_value) {
-                std::pop_heap(
-                  sorted.begin(), sorted.end(),
-                  [](const std::pair<float_t, irs::doc_id_t>& lhs,
-                     const std::pair<float_t, irs::doc_id_t>& rhs) noexcept {
-                    return lhs.first < rhs.first;
-                });
-
-                auto& back = sorted.back();
-                back.first = score_value;
-                back.second = doc->value;
-
-                std::push_heap(
-                  sorted.begin(), sorted.end(),
-                  [](const std::pair<float_t, irs::doc_id_t>& lhs,
-                     const std::pair<float_t, irs::doc_id_t>& rhs) noexcept {
-                    return lhs.first < rhs.first;
-                });
-              }
-            }
-          }
-
-          auto end = sorted.end();
-          for (auto begin = sorted.begin(); begin != end; --end) {
-            std::pop_heap(
-              begin, end,
-              [](const std::pair<float_t, irs::doc_id_t>& lhs,
-                 const std::pair<float_t, irs::doc_id_t>& rhs) noexcept {
-                return lhs.first < rhs.first;
-            });
-          }
+          doc_count = executeFilter(*filter, reader, order, limit, sorted);
         }
 
         const auto tdiff = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
@@ -738,6 +1074,22 @@ int search(const cmdline::parser& args) {
   const auto dir_type = args.exist(DIR_TYPE) ? args.get<std::string>(DIR_TYPE) : std::string("mmap");
   const auto format = args.exist(FORMAT) ? args.get<std::string>(FORMAT) : std::string("1_0");
 
+  benchmark_options_t bench;
+  const bool benchmark_mode = args.exist(BENCHMARK);
+
+  if (benchmark_mode) {
+    bench.concurrency = args.exist(CONCURRENCY)
+      ? parseConcurrency(args.get<std::string>(CONCURRENCY))
+      : std::vector<size_t>{ std::max(size_t(1), thrs) };
+    bench.warmup = args.get<size_t>(WARMUP);
+    bench.cold = args.exist(COLD);
+
+    if (bench.concurrency.empty()) {
+      std::cerr << "Invalid concurrency levels '" << args.get<std::string>(CONCURRENCY) << "'" << std::endl;
+      return 1;
+    }
+  }
+
   std::cout << "Max tasks in category="                      << maxtasks           << '\n'
             << "Task repeat count="                          << repeat             << '\n'
             << "Do task list shuffle="                       << shuffle            << '\n'
@@ -747,7 +1099,8 @@ int search(const cmdline::parser& args) {
             << "Scorer used for ranking query results="      << scorer             << '\n'
             << "Configuration argument format for query scorer=" << scorer_arg_format << '\n'
             << "Configuration argument for query scorer="    << scorer_arg         << '\n'
-            << "Output CSV="                                 << csv                << std::endl;
+            << "Output CSV="                                 << csv                << '\n'
+            << "Benchmark mode="                             << benchmark_mode     << std::endl;
 
   std::fstream in(args.get<std::string>(INPUT), std::fstream::in);
 
@@ -765,10 +1118,10 @@ int search(const cmdline::parser& args) {
       return 1;
     }
 
-    return search(path, dir_type, format, in, out, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg);
+    return search(path, dir_type, format, in, out, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg, benchmark_mode ? &bench : nullptr);
   }
 
-  return search(path, dir_type, format, in, std::cout, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg);
+  return search(path, dir_type, format, in, std::cout, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg, benchmark_mode ? &bench : nullptr);
 }
 
 int search(int argc, char* argv[]) {
@@ -790,6 +1143,10 @@ int search(int argc, char* argv[]) {
   cmdsearch.add<std::string>(SCORER_ARG_FMT, 0, "Configuration argument format for query scorer", false, "json"); // 'json' is the argument format for 'bm25'
   cmdsearch.add(RND, 0, "Shuffle tasks");
   cmdsearch.add(CSV, 0, "CSV output");
+  cmdsearch.add(BENCHMARK, 0, "Benchmark mode, report latency percentiles and QPS per query category as JSON");
+  cmdsearch.add<std::string>(CONCURRENCY, 0, "Comma separated numbers of search threads to benchmark with (benchmark mode)", false);
+  cmdsearch.add<size_t>(WARMUP, 0, "Number of warm-up passes before a measured run (benchmark mode)", false, size_t(1));
+  cmdsearch.add(COLD, 0, "Do a cold-cache run with OS page cache of index files dropped before warm-up (benchmark mode)");
 
   cmdsearch.parse(argc, argv);
 